@@ -23,6 +23,55 @@ PerformanceMetrics ResourceAnalytics::calculate_metrics() const {
     metrics.total_processes = all_processes.size();
     metrics.completed_processes = process_manager_.get_completed_count();
     metrics.context_switches = scheduler_.get_context_switch_count();
+    metrics.deadline_misses = scheduler_.get_deadline_miss_count();
+    metrics.admission_rejections = scheduler_.get_admission_rejection_count();
+    metrics.migrations = scheduler_.get_migration_count();
+    metrics.preemptions = scheduler_.get_preemption_count();
+    metrics.preemption_overhead = scheduler_.get_preemption_overhead();
+    size_t dispatch_slots = 0;
+    size_t idle_slots = 0;
+    for (size_t core = 0; core < scheduler_.get_core_count(); ++core) {
+        metrics.core_utilization.push_back(scheduler_.get_core_utilization(core));
+        const CoreStats& stats = scheduler_.get_core_stats(core);
+        dispatch_slots += stats.dispatches + stats.idle_quanta;
+        idle_slots += stats.idle_quanta;
+    }
+    if (dispatch_slots > 0) {
+        metrics.idle_core_waste = static_cast<double>(idle_slots) / dispatch_slots;
+    }
+    
+    for (ProcessPriority priority : {ProcessPriority::LOW, ProcessPriority::MEDIUM,
+                                     ProcessPriority::HIGH, ProcessPriority::CRITICAL}) {
+        metrics.max_wait_by_priority.push_back(scheduler_.get_wait_stats(priority).max_wait);
+        
+        const SloStats& slo = scheduler_.get_slo_stats(priority);
+        double attainment = slo.dispatches > 0 ? static_cast<double>(slo.met) / slo.dispatches : 1.0;
+        metrics.slo_attainment_by_priority.push_back(attainment);
+        if (slo.target != 0 && attainment < slo.quantile) {
+            metrics.slo_misses++;
+        }
+    }
+    
+    if (const CpuController* groups = scheduler_.get_cpu_controller()) {
+        for (uint32_t group = 0; group < groups->get_group_count(); ++group) {
+            CpuGroupStats stats = groups->get_stats(group);
+            metrics.quota_exhaustions += stats.throttled_periods;
+            metrics.throttled_time += stats.throttled_time;
+        }
+    }
+    
+    const LockStats& locks = scheduler_.get_lock_manager().get_stats();
+    metrics.lock_contentions = locks.contentions;
+    metrics.lock_blocking_time = locks.blocking_time;
+    metrics.inversion_time = locks.inversion_time;
+    metrics.max_inversion_time = locks.max_inversion_time;
+    
+    const GangStats& gangs = scheduler_.get_gang_stats();
+    metrics.gang_dispatches = gangs.dispatches;
+    if (gangs.quanta > 0) {
+        metrics.gang_fragmentation = static_cast<double>(gangs.fragmented_slots) /
+                                     (gangs.quanta * scheduler_.get_core_count());
+    }
     
     // Calculate throughput
     uint64_t time_elapsed = simulation_end_time_ - simulation_start_time_;
@@ -112,12 +161,90 @@ std::string ResourceAnalytics::generate_report() const {
     report << "  Avg Turnaround Time: " << metrics.average_turnaround_time << " ms\n";
     report << "  Avg Waiting Time: " << metrics.average_waiting_time << " ms\n";
     report << "  Context Switches: " << metrics.context_switches << "\n";
+    report << "  Preemptions: " << metrics.preemptions << " ("
+           << metrics.preemption_overhead << " ms overhead)\n";
     report << "\n";
     report << "Resource Utilization:\n";
     report << "  CPU Utilization: " << (metrics.cpu_utilization * 100.0) << "%\n";
     report << "  Memory Utilization: " << (metrics.memory_utilization * 100.0) << "%\n";
     report << "  Memory Fragmentation: " << (metrics.fragmentation * 100.0) << "%\n";
     report << "\n";
+    report << "Max Wait by Priority:\n";
+    report << "  LOW: " << metrics.max_wait_by_priority[0] << " ms\n";
+    report << "  MEDIUM: " << metrics.max_wait_by_priority[1] << " ms\n";
+    report << "  HIGH: " << metrics.max_wait_by_priority[2] << " ms\n";
+    report << "  CRITICAL: " << metrics.max_wait_by_priority[3] << " ms\n";
+    report << "\n";
+    const char* priority_names[] = {"LOW", "MEDIUM", "HIGH", "CRITICAL"};
+    bool has_slo = false;
+    size_t level = 0;
+    for (ProcessPriority priority : {ProcessPriority::LOW, ProcessPriority::MEDIUM,
+                                     ProcessPriority::HIGH, ProcessPriority::CRITICAL}) {
+        const SloStats& slo = scheduler_.get_slo_stats(priority);
+        if (slo.target != 0) {
+            if (!has_slo) {
+                report << "Latency SLOs (" << metrics.slo_misses << " missed):\n";
+                has_slo = true;
+            }
+            report << "  " << priority_names[level] << ": p" << (slo.quantile * 100.0)
+                   << " <= " << slo.target << " ms, estimate " << slo.estimate << " ms, "
+                   << (metrics.slo_attainment_by_priority[level] * 100.0) << "% of "
+                   << slo.dispatches << " waits within target, weight " << slo.weight << "\n";
+        }
+        level++;
+    }
+    if (has_slo) {
+        report << "\n";
+    }
+    report << "Real-Time Metrics:\n";
+    report << "  Deadline Misses: " << metrics.deadline_misses << "\n";
+    report << "  Admission Rejections: " << metrics.admission_rejections << "\n";
+    report << "  Admitted Utilization: " << (scheduler_.get_edf_utilization() * 100.0) << "%\n";
+    report << "\n";
+    report << "SMP Metrics:\n";
+    report << "  Cores: " << metrics.core_utilization.size() << "\n";
+    report << "  Migrations: " << metrics.migrations << "\n";
+    report << "  Idle Core Waste: " << (metrics.idle_core_waste * 100.0) << "%\n";
+    for (size_t core = 0; core < metrics.core_utilization.size(); ++core) {
+        const CoreStats& stats = scheduler_.get_core_stats(core);
+        report << "  Core " << core << ": " << (metrics.core_utilization[core] * 100.0)
+               << "% busy, " << stats.dispatches << " dispatches, "
+               << stats.steals << " steals, "
+               << stats.switch_overhead << "ms switch overhead\n";
+    }
+    report << "\n";
+    if (scheduler_.is_gang_scheduling()) {
+        const GangStats& gangs = scheduler_.get_gang_stats();
+        report << "Gang Scheduling:\n";
+        report << "  Gangs Dispatched: " << metrics.gang_dispatches << "\n";
+        report << "  Deferred (no room): " << gangs.deferrals << "\n";
+        report << "  Held (member not ready): " << gangs.incomplete << "\n";
+        report << "  Fragmentation: " << (metrics.gang_fragmentation * 100.0) << "%\n";
+        report << "\n";
+    }
+    if (const CpuController* groups = scheduler_.get_cpu_controller()) {
+        report << "CPU Groups:\n";
+        report << "  Quota Exhaustions: " << metrics.quota_exhaustions << "\n";
+        report << "  Throttled Time: " << metrics.throttled_time << " ms\n";
+        for (uint32_t group = 1; group < groups->get_group_count(); ++group) {
+            CpuGroupStats stats = groups->get_stats(group);
+            report << "  Group " << group << " (parent " << groups->get_parent(group) << "): "
+                   << stats.usage << "ms used, throttled in " << stats.throttled_periods
+                   << "/" << stats.periods << " periods, "
+                   << stats.throttled_time << "ms throttled\n";
+        }
+        report << "\n";
+    }
+    if (metrics.lock_contentions > 0) {
+        const LockStats& locks = scheduler_.get_lock_manager().get_stats();
+        report << "Locks (" << to_string(scheduler_.get_lock_protocol()) << " protocol):\n";
+        report << "  Acquisitions: " << locks.acquisitions << " ("
+               << metrics.lock_contentions << " blocked first)\n";
+        report << "  Blocking Time: " << metrics.lock_blocking_time << " ms\n";
+        report << "  Priority Inversions: " << locks.inversions << " ("
+               << metrics.inversion_time << " ms, longest " << metrics.max_inversion_time << " ms)\n";
+        report << "\n";
+    }
     report << "Optimization Effectiveness:\n";
     report << "  High throughput indicates efficient scheduling\n";
     report << "  Low fragmentation demonstrates effective memory management\n";
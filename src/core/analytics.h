@@ -22,6 +22,24 @@ struct PerformanceMetrics {
     size_t context_switches;     // Total context switches
     double memory_utilization;   // Memory usage percentage (0.0 to 1.0)
     double fragmentation;        // Memory fragmentation percentage (0.0 to 1.0)
+    size_t deadline_misses;      // Real-time processes completed after their deadline
+    size_t admission_rejections; // Failed EDF admission tests
+    std::vector<double> core_utilization; // Busy fraction of each core (0.0 to 1.0)
+    size_t migrations;           // Processes moved between cores
+    double idle_core_waste;      // Share of core dispatch slots that found no work (0.0 to 1.0)
+    size_t gang_dispatches;      // Process groups co-scheduled
+    double gang_fragmentation;   // Share of core slots left free while a gang was deferred (0.0 to 1.0)
+    std::vector<uint64_t> max_wait_by_priority; // Longest ready-queue wait: LOW, MEDIUM, HIGH, CRITICAL
+    size_t preemptions;          // Running processes displaced by a shorter arrival
+    uint64_t preemption_overhead; // Timer interrupt and switch-out cost of preemptions in ms
+    size_t quota_exhaustions;    // CPU group periods cut short by an exhausted quota, summed over groups
+    uint64_t throttled_time;     // Time CPU groups spent throttled in ms, summed over groups
+    size_t lock_contentions;     // Lock and semaphore operations that blocked
+    uint64_t lock_blocking_time; // Time processes spent blocked on locks in ms
+    uint64_t inversion_time;     // Part of it spent behind a lower-priority holder in ms
+    uint64_t max_inversion_time; // Longest single priority inversion in ms
+    std::vector<double> slo_attainment_by_priority; // Share of waits within the SLO target: LOW to CRITICAL, 1.0 without an SLO
+    size_t slo_misses;           // Priority levels whose attainment is below their SLO quantile
     
     PerformanceMetrics()
         : throughput(0.0),
@@ -32,7 +50,22 @@ struct PerformanceMetrics {
           completed_processes(0),
           context_switches(0),
           memory_utilization(0.0),
-          fragmentation(0.0) {}
+          fragmentation(0.0),
+          deadline_misses(0),
+          admission_rejections(0),
+          migrations(0),
+          idle_core_waste(0.0),
+          gang_dispatches(0),
+          gang_fragmentation(0.0),
+          preemptions(0),
+          preemption_overhead(0),
+          quota_exhaustions(0),
+          throttled_time(0),
+          lock_contentions(0),
+          lock_blocking_time(0),
+          inversion_time(0),
+          max_inversion_time(0),
+          slo_misses(0) {}
 };
 
 /**
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "process.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace osro {
+
+/**
+ * @brief Context switch cost model based on cache warmth
+ * 
+ * A process's working set stays in the cache of the core it last ran on
+ * and decays linearly while the process is away. Switching onto that
+ * core costs the base switch cost plus the refill cost scaled by how
+ * cold the cache has become; any other core starts fully cold.
+ */
+struct CacheModel {
+    uint64_t switch_cost;  // Switch onto a fully warm cache in milliseconds
+    uint64_t refill_cost;  // Extra cost of refilling a fully cold cache in milliseconds
+    uint64_t decay_time;   // Time for an idle cache to go fully cold in milliseconds
+
+    /**
+     * @brief Get how much of a process's working set survives on a core
+     * @param process Process about to run
+     * @param core Target core
+     * @param timestamp Current time
+     * @return double 1.0 for a fully warm cache down to 0.0 for a cold one
+     */
+    double get_warmth(const Process* process, size_t core, uint64_t timestamp) const noexcept {
+        if (!process || process->get_last_core() != core) {
+            return 0.0;
+        }
+        if (decay_time == 0) {
+            return timestamp > process->get_last_run_time() ? 0.0 : 1.0;
+        }
+        uint64_t elapsed = timestamp > process->get_last_run_time() ?
+                           timestamp - process->get_last_run_time() : 0;
+        return 1.0 - static_cast<double>(std::min(elapsed, decay_time)) / decay_time;
+    }
+
+    /**
+     * @brief Get the cost of switching a process onto a core
+     * @param process Process about to run (nullptr for idle)
+     * @param core Target core
+     * @param timestamp Current time
+     * @return uint64_t Switch cost in milliseconds
+     */
+    uint64_t get_switch_cost(const Process* process, size_t core, uint64_t timestamp) const noexcept {
+        if (!process) {
+            return switch_cost;
+        }
+        double coldness = 1.0 - get_warmth(process, core, timestamp);
+        return switch_cost + static_cast<uint64_t>(refill_cost * coldness + 0.5);
+    }
+};
+
+} // namespace osro
@@ -0,0 +1,310 @@
+#include "cpu_controller.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace osro {
+
+namespace {
+
+// Group vruntime delta, on the same microsecond scale as FairQueue::to_vruntime
+uint64_t to_group_vruntime(uint64_t runtime, uint64_t weight) noexcept {
+    return runtime * 1000 * FairQueue::kNice0Weight / weight;
+}
+
+} // namespace
+
+bool CpuController::VruntimeLess::operator()(const Group* a, const Group* b) const noexcept {
+    if (a->vruntime != b->vruntime) {
+        return a->vruntime < b->vruntime;
+    }
+    return a->id < b->id;
+}
+
+CpuController::CpuController()
+    : size_(0),
+      current_time_(0) {
+    groups_.push_back(std::make_unique<Group>());
+}
+
+uint32_t CpuController::create_group(uint32_t parent, uint64_t weight) {
+    if (parent >= groups_.size()) {
+        throw std::invalid_argument("Parent group does not exist");
+    }
+    if (weight == 0) {
+        throw std::invalid_argument("Group weight must be greater than 0");
+    }
+    
+    auto group = std::make_unique<Group>();
+    group->id = static_cast<uint32_t>(groups_.size());
+    group->parent = groups_[parent].get();
+    group->weight = weight;
+    group->period_start = current_time_;
+    group->parent->child_groups++;
+    groups_.push_back(std::move(group));
+    return groups_.back()->id;
+}
+
+void CpuController::set_weight(uint32_t group, uint64_t weight) {
+    if (group == kRootGroup) {
+        throw std::invalid_argument("Root group weight is fixed");
+    }
+    if (weight == 0) {
+        throw std::invalid_argument("Group weight must be greater than 0");
+    }
+    get(group).weight = weight;
+}
+
+void CpuController::set_quota(uint32_t group, uint64_t quota, uint64_t period) {
+    if (group == kRootGroup) {
+        throw std::invalid_argument("Root group cannot be limited");
+    }
+    if (period == 0) {
+        throw std::invalid_argument("Quota period must be greater than 0");
+    }
+    
+    Group& target = get(group);
+    target.quota = quota;
+    target.period = period;
+    target.period_start = current_time_;
+    target.consumed = 0;
+    if (target.throttled) {
+        if (current_time_ > target.throttled_since) {
+            target.stats.throttled_time += current_time_ - target.throttled_since;
+        }
+        target.throttled = false;
+        refresh(&target);
+    }
+}
+
+void CpuController::attach(Process* process, uint32_t group) {
+    Group& target = get(group);
+    if (group != kRootGroup && target.child_groups > 0) {
+        throw std::invalid_argument("Processes attach to leaf groups only");
+    }
+    
+    Group& current = group_of(process);
+    if (&current == &target) {
+        return;
+    }
+    
+    bool queued = erase(process);
+    
+    // Keep the process's lag relative to its queue, not its absolute vruntime
+    uint64_t lag = process->get_vruntime() > current.processes.get_min_vruntime() ?
+                   process->get_vruntime() - current.processes.get_min_vruntime() : 0;
+    process->set_vruntime(target.processes.get_min_vruntime() + lag);
+    process->set_cpu_group(group);
+    
+    if (queued) {
+        push(process);
+    }
+}
+
+void CpuController::push(Process* process) {
+    Group& group = group_of(process);
+    group.processes.push(process);
+    size_++;
+    refresh(&group);
+}
+
+Process* CpuController::top() const noexcept {
+    const Group* group = groups_[kRootGroup].get();
+    for (;;) {
+        Process* process = group->processes.top();
+        const Group* child = group->children.empty() ? nullptr : *group->children.begin();
+        if (!child || (process && process->get_vruntime() <= child->vruntime)) {
+            return process;
+        }
+        group = child;
+    }
+}
+
+Process* CpuController::pop() {
+    Process* process = top();
+    if (!process) {
+        return nullptr;
+    }
+    
+    // Advance each level's floor past the path being dispatched
+    for (Group* group = &group_of(process); group->parent; group = group->parent) {
+        Group* parent = group->parent;
+        parent->min_child_vruntime = std::max(parent->min_child_vruntime,
+                                              (*parent->children.begin())->vruntime);
+    }
+    erase(process);
+    return process;
+}
+
+bool CpuController::erase(Process* process) {
+    Group& group = group_of(process);
+    if (!group.processes.erase(process)) {
+        return false;
+    }
+    
+    size_--;
+    refresh(&group);
+    return true;
+}
+
+bool CpuController::contains(const Process* process) const noexcept {
+    return group_of(process).processes.contains(process);
+}
+
+std::vector<Process*> CpuController::release() {
+    std::vector<Process*> released;
+    for (auto& group : groups_) {
+        std::vector<Process*> queued = group->processes.release();
+        released.insert(released.end(), queued.begin(), queued.end());
+        group->children.clear();
+        group->queued = false;
+    }
+    size_ = 0;
+    return released;
+}
+
+const FairQueue& CpuController::get_queue(const Process* process) const noexcept {
+    return group_of(process).processes;
+}
+
+void CpuController::charge(const Process* process, uint64_t runtime, uint64_t timestamp) {
+    for (Group* group = &group_of(process); group; group = group->parent) {
+        group->stats.usage += runtime;
+        
+        if (group->parent) {
+            // Re-key in the parent's queue; std::set keys are immutable in place
+            if (group->queued) {
+                group->parent->children.erase(group);
+            }
+            group->vruntime += to_group_vruntime(runtime, group->weight);
+            if (group->queued) {
+                group->parent->children.insert(group);
+            }
+        }
+        
+        if (group->quota > 0) {
+            group->consumed += runtime;
+            if (!group->throttled && group->consumed >= group->quota) {
+                group->throttled = true;
+                group->throttled_since = std::max(timestamp, current_time_);
+                group->stats.throttled_periods++;
+                refresh(group);
+            }
+        }
+    }
+}
+
+uint64_t CpuController::get_quota_remaining(const Process* process) const noexcept {
+    uint64_t remaining = UINT64_MAX;
+    for (const Group* group = &group_of(process); group; group = group->parent) {
+        if (group->quota > 0) {
+            remaining = std::min(remaining, group->consumed < group->quota ?
+                                            group->quota - group->consumed : 0);
+        }
+    }
+    return remaining;
+}
+
+void CpuController::tick(uint64_t current_time) {
+    current_time_ = current_time;
+    
+    for (auto& group : groups_) {
+        if (group->quota == 0 || current_time < group->period_start + group->period) {
+            continue;
+        }
+        
+        uint64_t elapsed = (current_time - group->period_start) / group->period;
+        group->period_start += elapsed * group->period;
+        group->stats.periods += elapsed;
+        
+        // Overruns are paid back out of the refill
+        uint64_t refill = elapsed * group->quota;
+        group->consumed = group->consumed > refill ? group->consumed - refill : 0;
+        
+        if (group->throttled && group->consumed < group->quota) {
+            if (current_time > group->throttled_since) {
+                group->stats.throttled_time += current_time - group->throttled_since;
+            }
+            group->throttled = false;
+            refresh(group.get());
+        }
+    }
+}
+
+bool CpuController::is_throttled(uint32_t group) const {
+    return get(group).throttled;
+}
+
+CpuGroupStats CpuController::get_stats(uint32_t group) const {
+    const Group& target = get(group);
+    CpuGroupStats stats = target.stats;
+    if (target.throttled && current_time_ > target.throttled_since) {
+        stats.throttled_time += current_time_ - target.throttled_since;
+    }
+    return stats;
+}
+
+uint32_t CpuController::get_parent(uint32_t group) const {
+    const Group& target = get(group);
+    return target.parent ? target.parent->id : target.id;
+}
+
+void CpuController::reset() {
+    release();
+    current_time_ = 0;
+    for (auto& group : groups_) {
+        group->processes.reset();
+        group->period_start = 0;
+        group->consumed = 0;
+        group->throttled = false;
+        group->throttled_since = 0;
+        group->vruntime = 0;
+        group->min_child_vruntime = 0;
+        group->stats = CpuGroupStats{};
+    }
+}
+
+CpuController::Group& CpuController::get(uint32_t group) {
+    if (group >= groups_.size()) {
+        throw std::invalid_argument("CPU group does not exist");
+    }
+    return *groups_[group];
+}
+
+const CpuController::Group& CpuController::get(uint32_t group) const {
+    if (group >= groups_.size()) {
+        throw std::invalid_argument("CPU group does not exist");
+    }
+    return *groups_[group];
+}
+
+CpuController::Group& CpuController::group_of(const Process* process) noexcept {
+    uint32_t group = process->get_cpu_group();
+    return *groups_[group < groups_.size() ? group : kRootGroup];
+}
+
+const CpuController::Group& CpuController::group_of(const Process* process) const noexcept {
+    uint32_t group = process->get_cpu_group();
+    return *groups_[group < groups_.size() ? group : kRootGroup];
+}
+
+void CpuController::refresh(Group* group) {
+    for (; group->parent; group = group->parent) {
+        bool runnable = !group->throttled &&
+                        (!group->processes.empty() || !group->children.empty());
+        if (runnable == group->queued) {
+            return;
+        }
+        
+        Group* parent = group->parent;
+        if (runnable) {
+            // Rejoin level with the siblings instead of cashing in idle time
+            group->vruntime = std::max(group->vruntime, parent->min_child_vruntime);
+            parent->children.insert(group);
+        } else {
+            parent->children.erase(group);
+        }
+        group->queued = runnable;
+    }
+}
+
+} // namespace osro
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "process.h"
+#include "fair_queue.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief CPU accounting of one group, in the spirit of cgroup cpu.stat
+ */
+struct CpuGroupStats {
+    uint64_t usage = 0;            // CPU time charged to the group and its descendants in ms
+    size_t periods = 0;            // Enforcement periods elapsed while a quota was set
+    size_t throttled_periods = 0;  // Periods in which the group exhausted its quota
+    uint64_t throttled_time = 0;   // Time spent throttled in ms
+};
+
+/**
+ * @brief Hierarchy of weighted CPU groups with bandwidth quotas
+ *
+ * Models the cgroup CPU controller on top of the CFS-style fair queue.
+ * Every group keeps a FairQueue of its own runnable processes and a
+ * second queue of its runnable child groups, both keyed by virtual
+ * runtime, so picking the next process descends the tree taking the
+ * leftmost entity at each level. A group's virtual runtime advances by
+ * the CPU time of its subtree scaled by its weight, which splits the
+ * parent's share among siblings in proportion to their weights.
+ *
+ * A group with a quota may consume at most that much CPU time per
+ * period. Once it is exhausted the group is throttled: it leaves its
+ * parent's queue, taking its whole subtree with it, until a period
+ * boundary refills the quota. Overruns carry over as debt into the next
+ * period.
+ *
+ * Processes attach to leaf groups; unattached processes run in the root
+ * group and compete with the top-level groups.
+ */
+class CpuController {
+public:
+    static constexpr uint32_t kRootGroup = 0;
+    static constexpr uint64_t kDefaultWeight = FairQueue::kNice0Weight;
+    static constexpr uint64_t kDefaultPeriod = 100;
+
+    CpuController();
+    CpuController(const CpuController&) = delete;
+    CpuController& operator=(const CpuController&) = delete;
+
+    /**
+     * @brief Create a child group
+     * @param parent Parent group ID
+     * @param weight Share relative to sibling groups (kDefaultWeight = equal share)
+     * @return uint32_t New group ID
+     * @throws std::invalid_argument If the parent does not exist or weight is 0
+     */
+    uint32_t create_group(uint32_t parent = kRootGroup, uint64_t weight = kDefaultWeight);
+
+    /**
+     * @brief Change the weight of a group
+     * @param group Group ID (not the root)
+     * @param weight New weight, greater than 0
+     */
+    void set_weight(uint32_t group, uint64_t weight);
+
+    /**
+     * @brief Limit a group's CPU time per period
+     * @param group Group ID (not the root)
+     * @param quota CPU time allowed per period in milliseconds, 0 for unlimited
+     * @param period Enforcement period in milliseconds
+     */
+    void set_quota(uint32_t group, uint64_t quota, uint64_t period = kDefaultPeriod);
+
+    /**
+     * @brief Charge a process to a leaf group
+     *
+     * Moves the process (and its place in the queue, if queued) to the
+     * new group, rebasing its virtual runtime onto the new group's queue.
+     *
+     * @param process Process to attach
+     * @param group Leaf group ID, or kRootGroup to detach
+     * @throws std::invalid_argument If the group does not exist or has children
+     */
+    void attach(Process* process, uint32_t group);
+
+    /**
+     * @brief Queue a runnable process in its group
+     * @param process Process to queue (vruntime already placed)
+     */
+    void push(Process* process);
+
+    /**
+     * @brief Get the process the hierarchy runs next
+     * @return Process* Leftmost process of the leftmost runnable path, nullptr if none
+     */
+    Process* top() const noexcept;
+
+    /**
+     * @brief Remove and return the process the hierarchy runs next
+     * @return Process* Removed process, nullptr if none is runnable
+     */
+    Process* pop();
+
+    /**
+     * @brief Remove a queued process
+     * @param process Process to remove
+     * @return bool True if the process was queued here
+     */
+    bool erase(Process* process);
+
+    /**
+     * @brief Check whether a process is queued here
+     * @param process Process to look up
+     * @return bool True if queued
+     */
+    bool contains(const Process* process) const noexcept;
+
+    /**
+     * @brief Remove all queued processes
+     * @return std::vector<Process*> Previously queued processes
+     */
+    std::vector<Process*> release();
+
+    /**
+     * @brief Get the fair queue of a process's group
+     * @param process Process to look up
+     * @return const FairQueue& Queue the process joins when runnable
+     */
+    const FairQueue& get_queue(const Process* process) const noexcept;
+
+    /**
+     * @brief Charge CPU time to a process's group and its ancestors
+     * @param process Process that ran
+     * @param runtime CPU time consumed in milliseconds
+     * @param timestamp Time the process stopped running
+     */
+    void charge(const Process* process, uint64_t runtime, uint64_t timestamp);
+
+    /**
+     * @brief Get CPU time a process may still use before a group throttles
+     * @param process Process about to run
+     * @return uint64_t Smallest remaining quota on the path to the root,
+     *                  UINT64_MAX if no ancestor has a quota
+     */
+    uint64_t get_quota_remaining(const Process* process) const noexcept;
+
+    /**
+     * @brief Advance time, refilling quotas at period boundaries
+     * @param current_time Current simulation time in milliseconds
+     */
+    void tick(uint64_t current_time);
+
+    /**
+     * @brief Check whether a group is throttled
+     * @param group Group ID
+     * @return bool True if the group exhausted its quota this period
+     */
+    bool is_throttled(uint32_t group) const;
+
+    /**
+     * @brief Get accounting of a group, including an ongoing throttle
+     * @param group Group ID
+     * @return CpuGroupStats Group statistics
+     */
+    CpuGroupStats get_stats(uint32_t group) const;
+
+    /**
+     * @brief Get the parent of a group
+     * @param group Group ID
+     * @return uint32_t Parent group ID (the root is its own parent)
+     */
+    uint32_t get_parent(uint32_t group) const;
+
+    /**
+     * @brief Get number of groups including the root
+     * @return size_t Group count; IDs run from 0 to count - 1
+     */
+    size_t get_group_count() const noexcept { return groups_.size(); }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Drop queued processes, usage, quotas in flight and statistics
+     *
+     * The hierarchy, weights, quotas and attachments are kept.
+     */
+    void reset();
+
+private:
+    struct Group;
+
+    struct VruntimeLess {
+        bool operator()(const Group* a, const Group* b) const noexcept;
+    };
+
+    struct Group {
+        uint32_t id = kRootGroup;
+        Group* parent = nullptr;
+        uint64_t weight = kDefaultWeight;
+        uint64_t quota = 0;           // 0 = unlimited
+        uint64_t period = kDefaultPeriod;
+        uint64_t period_start = 0;
+        uint64_t consumed = 0;        // CPU time used this period, including carried debt
+        bool throttled = false;
+        uint64_t throttled_since = 0;
+        uint64_t vruntime = 0;        // Weighted CPU time of the subtree in microseconds
+        bool queued = false;          // Present in parent->children
+        size_t child_groups = 0;
+        FairQueue processes;
+        std::set<Group*, VruntimeLess> children;
+        uint64_t min_child_vruntime = 0;
+        CpuGroupStats stats;
+    };
+
+    std::vector<std::unique_ptr<Group>> groups_;
+    size_t size_;
+    uint64_t current_time_;
+
+    Group& get(uint32_t group);
+    const Group& get(uint32_t group) const;
+    Group& group_of(const Process* process) noexcept;
+    const Group& group_of(const Process* process) const noexcept;
+
+    /**
+     * @brief Add or remove a group and its ancestors from their parents'
+     *        queues after its runnable work or throttle state changed
+     * @param group Group whose state changed
+     */
+    void refresh(Group* group);
+};
+
+} // namespace osro
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "schedule_history.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Recorder selected at compile time; must be identical in every
+// translation unit (CMake sets it globally via OSRO_SCHEDULER_RECORDER)
+#define OSRO_RECORDER_NONE 0
+#define OSRO_RECORDER_COUNTING 1
+#define OSRO_RECORDER_FULL 2
+
+#ifndef OSRO_SCHEDULER_RECORDER
+#define OSRO_SCHEDULER_RECORDER OSRO_RECORDER_FULL
+#endif
+
+namespace osro {
+
+/**
+ * @brief Recorder that discards every event
+ * 
+ * Callers test kEnabled with if constexpr, so event construction is
+ * compiled out of the dispatch path entirely.
+ */
+struct NullRecorder {
+    static constexpr bool kEnabled = false;
+    static constexpr bool kKeepsHistory = false;
+
+    void record(const ScheduleEvent&) noexcept {}
+    void record(const ScheduleEvent*, size_t) noexcept {}
+    uint64_t get_event_count() const noexcept { return 0; }
+    uint64_t get_transition_count(ProcessState) const noexcept { return 0; }
+    void clear() noexcept {}
+};
+
+/**
+ * @brief Recorder that only counts transitions by target state
+ * 
+ * Fixed-size counters, no allocation.
+ */
+class CountingRecorder {
+public:
+    static constexpr bool kEnabled = true;
+    static constexpr bool kKeepsHistory = false;
+
+    void record(const ScheduleEvent& event) noexcept {
+        counts_[static_cast<size_t>(event.new_state)]++;
+        total_++;
+    }
+
+    void record(const ScheduleEvent* events, size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            counts_[static_cast<size_t>(events[i].new_state)]++;
+        }
+        total_ += count;
+    }
+
+    /**
+     * @brief Get number of recorded events
+     * @return uint64_t Events recorded since the last clear
+     */
+    uint64_t get_event_count() const noexcept { return total_; }
+
+    /**
+     * @brief Get number of transitions into a state
+     * @param state Target state
+     * @return uint64_t Transitions into state
+     */
+    uint64_t get_transition_count(ProcessState state) const noexcept {
+        return counts_[static_cast<size_t>(state)];
+    }
+
+    void clear() noexcept {
+        counts_.fill(0);
+        total_ = 0;
+    }
+
+private:
+    static constexpr size_t kStateCount = static_cast<size_t>(ProcessState::TERMINATED) + 1;
+
+    std::array<uint64_t, kStateCount> counts_{};
+    uint64_t total_ = 0;
+};
+
+/**
+ * @brief Recorder that counts transitions and keeps the event history
+ */
+class FullRecorder : public CountingRecorder {
+public:
+    static constexpr bool kKeepsHistory = true;
+
+    void record(const ScheduleEvent& event) {
+        CountingRecorder::record(event);
+        history_.record(event);
+    }
+
+    void record(const ScheduleEvent* events, size_t count) {
+        CountingRecorder::record(events, count);
+        history_.record(events, count);
+    }
+
+    void clear() noexcept {
+        CountingRecorder::clear();
+        history_.clear();
+    }
+
+    const ScheduleHistory& get_history() const noexcept { return history_; }
+    ScheduleHistory& get_history() noexcept { return history_; }
+
+private:
+    ScheduleHistory history_;
+};
+
+#if OSRO_SCHEDULER_RECORDER == OSRO_RECORDER_NONE
+using SchedulerRecorder = NullRecorder;
+#elif OSRO_SCHEDULER_RECORDER == OSRO_RECORDER_COUNTING
+using SchedulerRecorder = CountingRecorder;
+#elif OSRO_SCHEDULER_RECORDER == OSRO_RECORDER_FULL
+using SchedulerRecorder = FullRecorder;
+#else
+#error "OSRO_SCHEDULER_RECORDER must be OSRO_RECORDER_NONE, _COUNTING or _FULL"
+#endif
+
+} // namespace osro
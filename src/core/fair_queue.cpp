@@ -0,0 +1,99 @@
+#include "fair_queue.h"
+#include <algorithm>
+
+namespace osro {
+
+FairQueue::FairQueue()
+    : total_weight_(0),
+      min_vruntime_(0) {}
+
+uint64_t FairQueue::get_weight(ProcessPriority priority) noexcept {
+    // Linux sched_prio_to_weight entries for nice 5, 0, -5 and -10
+    switch (priority) {
+        case ProcessPriority::LOW:
+            return 335;
+        case ProcessPriority::MEDIUM:
+            return kNice0Weight;
+        case ProcessPriority::HIGH:
+            return 3121;
+        case ProcessPriority::CRITICAL:
+            return 9548;
+    }
+    return kNice0Weight;
+}
+
+uint64_t FairQueue::to_vruntime(uint64_t runtime, ProcessPriority priority) noexcept {
+    return runtime * 1000 * kNice0Weight / get_weight(priority);
+}
+
+void FairQueue::push(Process* process) {
+    uint64_t weight = get_weight(process->get_priority());
+    tree_.emplace(process, weight);
+    process->get_queue_hook().owner = this;
+    total_weight_ += weight;
+    update_min_vruntime();
+}
+
+Process* FairQueue::top() const noexcept {
+    return tree_.empty() ? nullptr : tree_.begin()->first;
+}
+
+Process* FairQueue::pop() {
+    if (tree_.empty()) {
+        return nullptr;
+    }
+    
+    Process* process = tree_.begin()->first;
+    uint64_t weight = tree_.begin()->second;
+    tree_.erase(tree_.begin());
+    detach(process, weight);
+    update_min_vruntime();
+    return process;
+}
+
+bool FairQueue::erase(Process* process) {
+    if (!contains(process)) {
+        return false;
+    }
+    
+    auto it = tree_.find(process);
+    uint64_t weight = it->second;
+    tree_.erase(it);
+    detach(process, weight);
+    update_min_vruntime();
+    return true;
+}
+
+bool FairQueue::contains(const Process* process) const noexcept {
+    return process->get_queue_hook().owner == this;
+}
+
+std::vector<Process*> FairQueue::release() {
+    std::vector<Process*> released;
+    released.reserve(tree_.size());
+    for (const auto& node : tree_) {
+        node.first->get_queue_hook().owner = nullptr;
+        released.push_back(node.first);
+    }
+    
+    tree_.clear();
+    total_weight_ = 0;
+    return released;
+}
+
+void FairQueue::reset(uint64_t min_vruntime) noexcept {
+    min_vruntime_ = min_vruntime;
+}
+
+void FairQueue::detach(Process* process, uint64_t weight) noexcept {
+    process->get_queue_hook().owner = nullptr;
+    total_weight_ -= weight;
+}
+
+void FairQueue::update_min_vruntime() noexcept {
+    if (!tree_.empty()) {
+        min_vruntime_ = std::max(min_vruntime_, tree_.begin()->first->get_vruntime());
+    }
+}
+
+} // namespace osro
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "process.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Runnable-process tree ordered by virtual runtime (CFS style)
+ * 
+ * Processes are kept in a red-black tree (std::map) keyed by virtual
+ * runtime with PID as tie-breaker. Like the kernel's rb_root_cached the
+ * tree tracks its leftmost node, so peeking at the next process is O(1)
+ * while enqueue and removal are O(log n). The queue also maintains the
+ * total load weight and a monotonic minimum virtual runtime used to
+ * place newly runnable processes. Each node records the weight it was
+ * charged at push, so a priority change while queued (a lock boost)
+ * cannot unbalance the total.
+ */
+class FairQueue {
+public:
+    /// Load weight of a MEDIUM priority process (nice 0 in Linux terms)
+    static constexpr uint64_t kNice0Weight = 1024;
+
+    FairQueue();
+    FairQueue(const FairQueue&) = delete;
+    FairQueue& operator=(const FairQueue&) = delete;
+
+    /**
+     * @brief Get load weight of a priority level
+     * @param priority Process priority
+     * @return uint64_t Load weight relative to kNice0Weight
+     */
+    static uint64_t get_weight(ProcessPriority priority) noexcept;
+
+    /**
+     * @brief Convert CPU time to virtual runtime for a priority level
+     * @param runtime CPU time in milliseconds
+     * @param priority Process priority
+     * @return uint64_t Virtual runtime delta in microseconds
+     */
+    static uint64_t to_vruntime(uint64_t runtime, ProcessPriority priority) noexcept;
+
+    /**
+     * @brief Insert a process keyed by its current virtual runtime
+     * @param process Process to insert
+     */
+    void push(Process* process);
+
+    /**
+     * @brief Get the process with the smallest virtual runtime
+     * @return Process* Leftmost process, nullptr if empty
+     */
+    Process* top() const noexcept;
+
+    /**
+     * @brief Remove and return the leftmost process
+     * @return Process* Removed process, nullptr if empty
+     */
+    Process* pop();
+
+    /**
+     * @brief Remove a queued process
+     * @param process Process to remove
+     * @return bool True if the process was queued here
+     */
+    bool erase(Process* process);
+
+    /**
+     * @brief Check whether a process is queued here
+     * @param process Process to look up
+     * @return bool True if queued
+     */
+    bool contains(const Process* process) const noexcept;
+
+    /**
+     * @brief Remove all processes in virtual runtime order
+     * @return std::vector<Process*> Previously queued processes
+     */
+    std::vector<Process*> release();
+
+    /**
+     * @brief Get the monotonic minimum virtual runtime
+     * @return uint64_t Minimum virtual runtime in microseconds
+     */
+    uint64_t get_min_vruntime() const noexcept { return min_vruntime_; }
+
+    /**
+     * @brief Get the summed load weight of queued processes
+     * @return uint64_t Total load weight
+     */
+    uint64_t get_total_weight() const noexcept { return total_weight_; }
+
+    /**
+     * @brief Visit every process in virtual runtime order
+     * @param visit Callable taking Process*
+     */
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const {
+        for (const auto& node : tree_) {
+            visit(node.first);
+        }
+    }
+
+    size_t size() const noexcept { return tree_.size(); }
+    bool empty() const noexcept { return tree_.empty(); }
+
+    /**
+     * @brief Reset the minimum virtual runtime (queue must be empty)
+     * @param min_vruntime New minimum virtual runtime in microseconds
+     */
+    void reset(uint64_t min_vruntime = 0) noexcept;
+
+private:
+    struct VruntimeLess {
+        bool operator()(const Process* a, const Process* b) const noexcept {
+            if (a->get_vruntime() != b->get_vruntime()) {
+                return a->get_vruntime() < b->get_vruntime();
+            }
+            return a->get_pid() < b->get_pid();
+        }
+    };
+
+    std::map<Process*, uint64_t, VruntimeLess> tree_;  // Process -> charged weight
+    uint64_t total_weight_;
+    uint64_t min_vruntime_;
+
+    void detach(Process* process, uint64_t weight) noexcept;
+    void update_min_vruntime() noexcept;
+};
+
+} // namespace osro
@@ -10,7 +10,10 @@ HardwareSimulator::HardwareSimulator(Scheduler& scheduler, MemoryManager& memory
     : scheduler_(scheduler),
       memory_manager_(memory_manager),
       interrupt_queue_(interrupt_comparator),
-      total_overhead_(0) {}
+      total_overhead_(0),
+      cache_model_{2, 6, 100},
+      next_wait_id_(0),
+      io_completions_(0) {}
 
 uint64_t HardwareSimulator::simulate_timer_interrupt(Process* current_process, uint64_t timestamp) {
     Interrupt timer_interrupt(timestamp, InterruptType::TIMER, 
@@ -27,6 +30,70 @@ bool HardwareSimulator::simulate_io_interrupt(uint32_t process_id, uint64_t time
     return (handle_io_interrupt(io_interrupt) > 0);
 }
 
+void HardwareSimulator::start_io(Process* process, uint32_t device, uint64_t timestamp, uint64_t latency) {
+    if (!process) {
+        return;
+    }
+    if (process->is_queued()) {
+        throw std::runtime_error("Process must not be queued or waiting to start I/O");
+    }
+    
+    scheduler_.block_process(process);
+    wait_queues_[device].push_back(process);
+    
+    uint64_t wait_id = next_wait_id_++;
+    wait_ids_[process->get_pid()] = wait_id;
+    io_timers_.schedule(timestamp + latency, IoRequest{process, device, wait_id});
+}
+
+size_t HardwareSimulator::signal_device(uint32_t device, uint64_t timestamp) {
+    auto it = wait_queues_.find(device);
+    if (it == wait_queues_.end()) {
+        return 0;
+    }
+    
+    // Their completion timers go stale and are skipped when they fire
+    size_t woken = 0;
+    while (Process* process = it->second.front()) {
+        wake(process, it->second, device, timestamp);
+        woken++;
+    }
+    return woken;
+}
+
+size_t HardwareSimulator::complete_all_io(uint64_t timestamp) {
+    size_t woken = 0;
+    for (auto& entry : wait_queues_) {
+        while (Process* process = entry.second.front()) {
+            wake(process, entry.second, entry.first, timestamp);
+            woken++;
+        }
+    }
+    io_timers_.reset(timestamp);
+    return woken;
+}
+
+size_t HardwareSimulator::get_waiting_count() const noexcept {
+    return wait_ids_.size();
+}
+
+size_t HardwareSimulator::get_waiting_count(uint32_t device) const {
+    auto it = wait_queues_.find(device);
+    return it != wait_queues_.end() ? it->second.size() : 0;
+}
+
+size_t HardwareSimulator::get_io_completion_count() const noexcept {
+    return io_completions_;
+}
+
+void HardwareSimulator::clear_wait_queues() {
+    for (auto& entry : wait_queues_) {
+        entry.second.clear();
+    }
+    wait_ids_.clear();
+    io_timers_.reset(io_timers_.get_time());
+}
+
 uint64_t HardwareSimulator::simulate_system_call(uint32_t process_id, 
                                                const std::string& call_type, 
                                                uint64_t timestamp) {
@@ -36,6 +103,32 @@ uint64_t HardwareSimulator::simulate_system_call(uint32_t process_id,
     return handle_system_call_interrupt(syscall_interrupt);
 }
 
+uint64_t HardwareSimulator::simulate_system_call(Process* process, SyncOperation operation, uint32_t object,
+                                                 uint64_t timestamp) {
+    if (!process) {
+        return 0;
+    }
+    
+    uint64_t overhead = simulate_system_call(process->get_pid(), to_string(operation), timestamp);
+    
+    LockManager& locks = scheduler_.get_lock_manager();
+    switch (operation) {
+        case SyncOperation::MUTEX_LOCK:
+            locks.lock(process, object, timestamp);
+            break;
+        case SyncOperation::MUTEX_UNLOCK:
+            locks.unlock(process, object, timestamp);
+            break;
+        case SyncOperation::SEMAPHORE_WAIT:
+            locks.wait(process, object, timestamp);
+            break;
+        case SyncOperation::SEMAPHORE_POST:
+            locks.post(object, timestamp);
+            break;
+    }
+    return overhead;
+}
+
 bool HardwareSimulator::simulate_hardware_fault(const std::string& fault_description, uint64_t timestamp) {
     Interrupt fault_interrupt(timestamp, InterruptType::HARDWARE_FAULT, 0, fault_description);
     schedule_interrupt(fault_interrupt);
@@ -45,6 +138,15 @@ bool HardwareSimulator::simulate_hardware_fault(const std::string& fault_descrip
 size_t HardwareSimulator::process_interrupts(uint64_t current_time) {
     size_t processed = 0;
     
+    io_timers_.advance(current_time, [&](const IoRequest& request) {
+        auto it = wait_ids_.find(request.process->get_pid());
+        if (it == wait_ids_.end() || it->second != request.wait_id) {
+            return;
+        }
+        wake(request.process, wait_queues_[request.device], request.device, io_timers_.get_time());
+        processed++;
+    });
+    
     while (!interrupt_queue_.empty() && interrupt_queue_.top().timestamp <= current_time) {
         Interrupt interrupt = interrupt_queue_.top();
         interrupt_queue_.pop();
@@ -92,12 +194,14 @@ const std::vector<Interrupt>& HardwareSimulator::get_interrupt_history() const {
     return interrupt_history_;
 }
 
-uint64_t HardwareSimulator::simulate_hardware_context_switch(Process* from, Process* to, uint64_t timestamp) {
-    // Simulate hardware-level context switch overhead
-    uint64_t overhead = 2; // 2ms hardware context switch overhead
+uint64_t HardwareSimulator::simulate_hardware_context_switch(Process* from, Process* to, uint64_t timestamp,
+                                                             size_t core) {
+    // Base switch cost plus refilling whatever the incoming process lost
+    uint64_t overhead = cache_model_.get_switch_cost(to, core, timestamp);
     
     // Simulate MMU operations
     if (from) {
+        from->set_last_run(static_cast<uint32_t>(core), timestamp);
         simulate_mmu_translation(from->get_pid(), 0); // Flush TLB
     }
     
@@ -109,13 +213,43 @@ uint64_t HardwareSimulator::simulate_hardware_context_switch(Process* from, Proc
     return overhead;
 }
 
+uint64_t HardwareSimulator::preempt_process(Process* running, size_t core, uint64_t timestamp) {
+    if (!running) {
+        return 0;
+    }
+    
+    uint64_t overhead = simulate_timer_interrupt(running, timestamp);
+    overhead += simulate_hardware_context_switch(running, nullptr, timestamp, core);
+    scheduler_.preempt(running, core, overhead);
+    return overhead;
+}
+
+void HardwareSimulator::set_cache_model(const CacheModel& model) {
+    cache_model_ = model;
+}
+
 uint64_t HardwareSimulator::get_total_overhead() const noexcept {
     return total_overhead_;
 }
 
 void HardwareSimulator::reset() {
     clear_interrupts();
+    clear_wait_queues();
+    io_timers_.reset();
     total_overhead_ = 0;
+    io_completions_ = 0;
+}
+
+void HardwareSimulator::wake(Process* process, ProcessList& queue, uint32_t device, uint64_t timestamp) {
+    queue.erase(process);
+    wait_ids_.erase(process->get_pid());
+    io_completions_++;
+    
+    Interrupt completion(timestamp, InterruptType::I_O, device, "I/O operation completed");
+    total_overhead_ += handle_io_interrupt(completion);
+    interrupt_history_.push_back(completion);
+    
+    scheduler_.add_to_ready_queue(process);
 }
 
 uint64_t HardwareSimulator::handle_timer_interrupt(const Interrupt& interrupt) {
@@ -3,7 +3,10 @@
 #include "process.h"
 #include "scheduler.h"
 #include "memory_manager.h"
+#include "process_list.h"
+#include "../utils/timer_wheel.h"
 #include <functional>
+#include <unordered_map>
 #include <vector>
 #include <queue>
 
@@ -65,6 +68,66 @@ public:
      */
     bool simulate_io_interrupt(uint32_t process_id, uint64_t timestamp);
 
+    /**
+     * @brief Block a process on a device until its I/O completes
+     * 
+     * The process leaves the CPU through the scheduler and parks on the
+     * device's wait queue; a completion timer raises the I/O interrupt
+     * after the latency and moves it back to READY.
+     * 
+     * @param process Running process issuing the request
+     * @param device Device the request goes to
+     * @param timestamp Time the request is issued
+     * @param latency Time until the device completes the request
+     * @throws std::runtime_error If the process is already queued or waiting
+     */
+    void start_io(Process* process, uint32_t device, uint64_t timestamp, uint64_t latency);
+
+    /**
+     * @brief Wake every process waiting on a device
+     * @param device Device that raised the event
+     * @param timestamp Time of the event
+     * @return size_t Processes moved back to READY
+     */
+    size_t signal_device(uint32_t device, uint64_t timestamp);
+
+    /**
+     * @brief Complete all outstanding I/O and restart the completion clock
+     * 
+     * For simulations that restart time: every waiting process becomes
+     * READY and pending completion timers are dropped.
+     * 
+     * @param timestamp Time the clock restarts at
+     * @return size_t Processes woken
+     */
+    size_t complete_all_io(uint64_t timestamp);
+
+    /**
+     * @brief Get number of processes blocked on I/O
+     * @return size_t Waiting processes across all devices
+     */
+    size_t get_waiting_count() const noexcept;
+
+    /**
+     * @brief Get number of processes blocked on one device
+     * @param device Device ID
+     * @return size_t Waiting processes
+     */
+    size_t get_waiting_count(uint32_t device) const;
+
+    /**
+     * @brief Get number of I/O requests completed since the last reset
+     * @return size_t Completed requests, including device-wide wakeups
+     */
+    size_t get_io_completion_count() const noexcept;
+
+    /**
+     * @brief Forget every waiting process without waking it
+     * 
+     * Call before the waiting processes are destroyed.
+     */
+    void clear_wait_queues();
+
     /**
      * @brief Simulate system call
      * @param process_id Process making the system call
@@ -74,6 +137,22 @@ public:
      */
     uint64_t simulate_system_call(uint32_t process_id, const std::string& call_type, uint64_t timestamp);
 
+    /**
+     * @brief Simulate a mutex or semaphore system call
+     * 
+     * Runs the operation against the scheduler's lock table. A process
+     * that has to wait leaves the call BLOCKED and is made READY again
+     * when the object is handed to it.
+     * 
+     * @param process Running process making the call
+     * @param operation Lock operation
+     * @param object Mutex or semaphore ID
+     * @param timestamp Timestamp of call
+     * @return uint64_t System call overhead
+     */
+    uint64_t simulate_system_call(Process* process, SyncOperation operation, uint32_t object,
+                                  uint64_t timestamp);
+
     /**
      * @brief Simulate hardware fault
      * @param fault_description Description of the fault
@@ -84,6 +163,10 @@ public:
 
     /**
      * @brief Process pending interrupts
+     * 
+     * Fires the I/O completion timers due by current_time first, so the
+     * processes they wake are READY for the next dispatch.
+     * 
      * @param current_time Current simulation time
      * @return size_t Number of interrupts processed
      */
@@ -114,12 +197,39 @@ public:
 
     /**
      * @brief Simulate context switch at hardware level
+     * 
+     * Register save/restore and the TLB flush cost the model's base switch
+     * cost; refilling caches and TLB adds up to the refill cost depending
+     * on how long ago the incoming process last ran on the core.
+     * 
      * @param from Process switching from
      * @param to Process switching to
      * @param timestamp Timestamp of switch
+     * @param core Core the switch happens on
      * @return uint64_t Hardware context switch time
      */
-    uint64_t simulate_hardware_context_switch(Process* from, Process* to, uint64_t timestamp);
+    uint64_t simulate_hardware_context_switch(Process* from, Process* to, uint64_t timestamp,
+                                              size_t core = 0);
+
+    /**
+     * @brief Preempt a running process through the timer interrupt path
+     * 
+     * Raises a timer interrupt, saves the running context (switch-out
+     * cost) and hands the process back to the scheduler's ready queue.
+     * The incoming process's switch-in is charged when it is dispatched.
+     * 
+     * @param running Process losing the CPU
+     * @param core Core it was running on
+     * @param timestamp Time of preemption
+     * @return uint64_t Preemption overhead in milliseconds
+     */
+    uint64_t preempt_process(Process* running, size_t core, uint64_t timestamp);
+
+    /**
+     * @brief Set the cache warmth model used for hardware switch costs
+     * @param model Cache model
+     */
+    void set_cache_model(const CacheModel& model);
 
     /**
      * @brief Get total hardware overhead
@@ -142,6 +252,23 @@ private:
     
     std::vector<Interrupt> interrupt_history_;
     uint64_t total_overhead_;
+    CacheModel cache_model_;
+    
+    /**
+     * @brief Completion timer of one I/O request
+     */
+    struct IoRequest {
+        Process* process;
+        uint32_t device;
+        uint64_t wait_id;  // Stale if the process was woken by other means
+    };
+    
+    // Waiting processes link through their queue hook, which is free while blocked
+    std::unordered_map<uint32_t, ProcessList> wait_queues_;
+    std::unordered_map<uint32_t, uint64_t> wait_ids_;  // PID -> current wait
+    TimerWheel<IoRequest> io_timers_;
+    uint64_t next_wait_id_;
+    size_t io_completions_;
     
     /**
      * @brief Comparator for interrupt priority queue
@@ -178,6 +305,15 @@ private:
      */
     uint64_t handle_hardware_fault_interrupt(const Interrupt& interrupt);
     
+    /**
+     * @brief Take a process off a wait queue and make it READY
+     * @param process Waiting process
+     * @param queue Wait queue holding it
+     * @param device Device the process waited on
+     * @param timestamp Time of the completion interrupt
+     */
+    void wake(Process* process, ProcessList& queue, uint32_t device, uint64_t timestamp);
+    
     /**
      * @brief Simulate memory management unit operation
      * @param process_id Process ID
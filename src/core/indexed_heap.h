@@ -0,0 +1,264 @@
+#pragma once
+
+#include "process.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Indexed d-ary min-heap of processes
+ *
+ * Keeps the process that must be dispatched first at the root. Every
+ * element's slot is stored in its QueueHook, so a queued process can be
+ * removed or re-keyed in O(log n) without scanning. A wider fan-out than
+ * a binary heap keeps the tree shallow, which pays off on the sift-up
+ * heavy enqueue path of large ready queues.
+ *
+ * @tparam Compare Strict weak ordering; Compare(a, b) is true when a must
+ *                 be dispatched before b
+ * @tparam Arity Number of children per node (at least 2)
+ */
+template<typename Compare, size_t Arity = 4>
+class IndexedHeap {
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+public:
+    explicit IndexedHeap(Compare compare = Compare()) : compare_(compare) {}
+    IndexedHeap(const IndexedHeap&) = delete;
+    IndexedHeap& operator=(const IndexedHeap&) = delete;
+
+    /**
+     * @brief Insert a process
+     * @param process Process to insert (must not already be queued)
+     */
+    void push(Process* process) {
+        process->get_queue_hook().owner = this;
+        heap_.push_back(process);
+        sift_up(heap_.size() - 1);
+    }
+
+    /**
+     * @brief Insert several processes
+     *
+     * Sifts each one up when the batch is small relative to the heap and
+     * re-heapifies in O(n) when it is large enough for that to be cheaper.
+     *
+     * @param processes First process (none may already be queued)
+     * @param count Number of processes
+     */
+    void push_range(Process* const* processes, size_t count) {
+        size_t depth = 1;
+        for (size_t nodes = heap_.size() + count; nodes > Arity; nodes /= Arity) {
+            ++depth;
+        }
+        bool rebuild = count * depth >= heap_.size() + count;
+
+        heap_.reserve(heap_.size() + count);
+        for (size_t i = 0; i < count; ++i) {
+            processes[i]->get_queue_hook().owner = this;
+            heap_.push_back(processes[i]);
+            if (rebuild) {
+                processes[i]->get_queue_hook().slot = heap_.size() - 1;
+            } else {
+                sift_up(heap_.size() - 1);
+            }
+        }
+        if (rebuild) {
+            heapify();
+        }
+    }
+
+    /**
+     * @brief Get the process that would be dispatched next
+     * @return Process* Root of the heap, nullptr if empty
+     */
+    Process* top() const noexcept {
+        return heap_.empty() ? nullptr : heap_.front();
+    }
+
+    /**
+     * @brief Remove and return the root process
+     * @return Process* Removed process, nullptr if empty
+     */
+    Process* pop() {
+        if (heap_.empty()) {
+            return nullptr;
+        }
+        Process* root = heap_.front();
+        remove_at(0);
+        return root;
+    }
+
+    /**
+     * @brief Remove an arbitrary queued process
+     * @param process Process to remove
+     * @return bool True if the process was queued
+     */
+    bool erase(Process* process) {
+        if (!contains(process)) {
+            return false;
+        }
+        remove_at(process->get_queue_hook().slot);
+        return true;
+    }
+
+    /**
+     * @brief Restore heap order after a queued process changed its key
+     * @param process Process whose key changed
+     * @return bool True if the process was queued
+     */
+    bool update(Process* process) {
+        if (!contains(process)) {
+            return false;
+        }
+        size_t index = sift_up(process->get_queue_hook().slot);
+        sift_down(index);
+        return true;
+    }
+
+    /**
+     * @brief Check whether a process is queued
+     * @param process Process to look up
+     * @return bool True if queued
+     */
+    bool contains(const Process* process) const noexcept {
+        return process->get_queue_hook().owner == this;
+    }
+
+    size_t size() const noexcept { return heap_.size(); }
+    bool empty() const noexcept { return heap_.empty(); }
+
+    /**
+     * @brief Remove all processes
+     */
+    void clear() noexcept {
+        for (Process* process : heap_) {
+            detach(process);
+        }
+        heap_.clear();
+    }
+
+    /**
+     * @brief Replace the contents with the given processes in O(n)
+     * @param processes Processes to heapify
+     */
+    void assign(std::vector<Process*> processes) {
+        clear();
+        heap_ = std::move(processes);
+        for (size_t i = 0; i < heap_.size(); ++i) {
+            heap_[i]->get_queue_hook().owner = this;
+            heap_[i]->get_queue_hook().slot = i;
+        }
+        heapify();
+    }
+
+    /**
+     * @brief Move all processes out in unspecified order and empty the heap
+     * @return std::vector<Process*> Previously queued processes
+     */
+    std::vector<Process*> release() {
+        for (Process* process : heap_) {
+            detach(process);
+        }
+        std::vector<Process*> released;
+        released.swap(heap_);
+        return released;
+    }
+
+    /**
+     * @brief Visit every process in heap (not dispatch) order
+     * @param visit Callable taking Process*
+     */
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const {
+        for (Process* process : heap_) {
+            visit(process);
+        }
+    }
+
+    /**
+     * @brief Access the underlying array (heap order, not dispatch order)
+     * @return const std::vector<Process*>& Queued processes
+     */
+    const std::vector<Process*>& data() const noexcept { return heap_; }
+
+private:
+    std::vector<Process*> heap_;
+    Compare compare_;
+
+    static size_t parent(size_t index) noexcept { return (index - 1) / Arity; }
+    static size_t first_child(size_t index) noexcept { return index * Arity + 1; }
+
+    static void detach(Process* process) noexcept {
+        QueueHook& hook = process->get_queue_hook();
+        hook.slot = QueueHook::npos;
+        hook.owner = nullptr;
+    }
+
+    void heapify() {
+        if (heap_.size() > 1) {
+            for (size_t i = parent(heap_.size() - 1) + 1; i-- > 0; ) {
+                sift_down(i);
+            }
+        }
+    }
+
+    void place(size_t index, Process* process) noexcept {
+        heap_[index] = process;
+        process->get_queue_hook().slot = index;
+    }
+
+    void remove_at(size_t index) {
+        detach(heap_[index]);
+        Process* last = heap_.back();
+        heap_.pop_back();
+
+        if (index < heap_.size()) {
+            place(index, last);
+            index = sift_up(index);
+            sift_down(index);
+        }
+    }
+
+    size_t sift_up(size_t index) {
+        Process* moving = heap_[index];
+        while (index > 0) {
+            size_t up = parent(index);
+            if (!compare_(moving, heap_[up])) {
+                break;
+            }
+            place(index, heap_[up]);
+            index = up;
+        }
+        place(index, moving);
+        return index;
+    }
+
+    void sift_down(size_t index) {
+        Process* moving = heap_[index];
+        const size_t count = heap_.size();
+        for (;;) {
+            size_t child = first_child(index);
+            if (child >= count) {
+                break;
+            }
+            size_t best = child;
+            size_t last = (child + Arity < count) ? child + Arity : count;
+            for (++child; child < last; ++child) {
+                if (compare_(heap_[child], heap_[best])) {
+                    best = child;
+                }
+            }
+            if (!compare_(heap_[best], moving)) {
+                break;
+            }
+            place(index, heap_[best]);
+            index = best;
+        }
+        place(index, moving);
+    }
+};
+
+} // namespace osro
@@ -0,0 +1,253 @@
+#include "lock_manager.h"
+#include "scheduler.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace osro {
+
+const char* to_string(LockProtocol protocol) noexcept {
+    switch (protocol) {
+        case LockProtocol::NONE:
+            return "None";
+        case LockProtocol::PRIORITY_INHERITANCE:
+            return "Inheritance";
+        case LockProtocol::PRIORITY_CEILING:
+            return "Ceiling";
+    }
+    return "Unknown";
+}
+
+const char* to_string(SyncOperation operation) noexcept {
+    switch (operation) {
+        case SyncOperation::MUTEX_LOCK:
+            return "mutex_lock";
+        case SyncOperation::MUTEX_UNLOCK:
+            return "mutex_unlock";
+        case SyncOperation::SEMAPHORE_WAIT:
+            return "sem_wait";
+        case SyncOperation::SEMAPHORE_POST:
+            return "sem_post";
+    }
+    return "unknown";
+}
+
+LockManager::LockManager(Scheduler& scheduler)
+    : scheduler_(scheduler) {}
+
+uint32_t LockManager::create_mutex(ProcessPriority ceiling) {
+    auto object = std::make_unique<SyncObject>();
+    object->ceiling = ceiling;
+    objects_.push_back(std::move(object));
+    return static_cast<uint32_t>(objects_.size() - 1);
+}
+
+uint32_t LockManager::create_semaphore(uint64_t count) {
+    auto object = std::make_unique<SyncObject>();
+    object->mutex = false;
+    object->count = count;
+    objects_.push_back(std::move(object));
+    return static_cast<uint32_t>(objects_.size() - 1);
+}
+
+bool LockManager::lock(Process* process, uint32_t mutex, uint64_t timestamp) {
+    SyncObject& object = get(mutex, true);
+    if (object.owner == process) {
+        throw std::runtime_error("Mutex is already held by the process");
+    }
+    
+    if (!object.owner) {
+        object.owner = process;
+        held_[process->get_pid()].push_back(mutex);
+        stats_.acquisitions++;
+        refresh_priority(process);
+        return true;
+    }
+    
+    block(process, mutex, timestamp);
+    if (object.owner->get_base_priority() < process->get_base_priority()) {
+        waits_[process->get_pid()].inverted = true;
+    }
+    
+    // The holder now runs on behalf of a more urgent waiter
+    refresh_priority(object.owner);
+    return false;
+}
+
+Process* LockManager::unlock(Process* process, uint32_t mutex, uint64_t timestamp) {
+    SyncObject& object = get(mutex, true);
+    if (!process || object.owner != process) {
+        throw std::runtime_error("Mutex is not held by the process");
+    }
+    
+    auto held = held_.find(process->get_pid());
+    held->second.erase(std::find(held->second.begin(), held->second.end(), mutex));
+    if (held->second.empty()) {
+        held_.erase(held);
+    }
+    object.owner = nullptr;
+    refresh_priority(process);
+    
+    Process* next = object.waiters.pop();
+    if (!next) {
+        return nullptr;
+    }
+    
+    // Hand over directly so a newcomer cannot barge past the waiters
+    object.owner = next;
+    held_[next->get_pid()].push_back(mutex);
+    wake(next, timestamp);
+    refresh_priority(next);
+    return next;
+}
+
+bool LockManager::wait(Process* process, uint32_t semaphore, uint64_t timestamp) {
+    SyncObject& object = get(semaphore, false);
+    if (object.count > 0) {
+        object.count--;
+        stats_.acquisitions++;
+        return true;
+    }
+    
+    block(process, semaphore, timestamp);
+    return false;
+}
+
+Process* LockManager::post(uint32_t semaphore, uint64_t timestamp) {
+    SyncObject& object = get(semaphore, false);
+    Process* next = object.waiters.pop();
+    if (!next) {
+        object.count++;
+        return nullptr;
+    }
+    
+    wake(next, timestamp);
+    return next;
+}
+
+size_t LockManager::release_all(Process* process, uint64_t timestamp) {
+    auto held = held_.find(process->get_pid());
+    if (held == held_.end()) {
+        return 0;
+    }
+    
+    // unlock() edits the list, so work from a copy
+    std::vector<uint32_t> mutexes = held->second;
+    for (uint32_t mutex : mutexes) {
+        unlock(process, mutex, timestamp);
+    }
+    return mutexes.size();
+}
+
+Process* LockManager::get_owner(uint32_t mutex) const {
+    return get(mutex, true).owner;
+}
+
+size_t LockManager::get_waiter_count(uint32_t object) const {
+    if (object >= objects_.size()) {
+        throw std::invalid_argument("Lock object does not exist");
+    }
+    return objects_[object]->waiters.size();
+}
+
+void LockManager::refresh_priority(Process* process) {
+    ProcessPriority priority = process->get_base_priority();
+    LockProtocol protocol = scheduler_.get_lock_protocol();
+    
+    auto held = held_.find(process->get_pid());
+    if (held != held_.end() && protocol != LockProtocol::NONE) {
+        for (uint32_t mutex : held->second) {
+            const SyncObject& object = *objects_[mutex];
+            if (protocol == LockProtocol::PRIORITY_CEILING) {
+                priority = std::max(priority, object.ceiling);
+            } else if (const Process* waiter = object.waiters.top()) {
+                priority = std::max(priority, waiter->get_priority());
+            }
+        }
+    }
+    
+    set_priority(process, priority);
+}
+
+void LockManager::reset() {
+    for (auto& object : objects_) {
+        object->waiters.for_each([](Process* process) {
+            process->set_priority(process->get_base_priority());
+        });
+        object->waiters.clear();
+        if (object->owner) {
+            object->owner->set_priority(object->owner->get_base_priority());
+            object->owner = nullptr;
+        }
+    }
+    held_.clear();
+    waits_.clear();
+    stats_ = LockStats{};
+}
+
+LockManager::SyncObject& LockManager::get(uint32_t object, bool mutex) {
+    if (object >= objects_.size() || objects_[object]->mutex != mutex) {
+        throw std::invalid_argument(mutex ? "Mutex does not exist" : "Semaphore does not exist");
+    }
+    return *objects_[object];
+}
+
+const LockManager::SyncObject& LockManager::get(uint32_t object, bool mutex) const {
+    if (object >= objects_.size() || objects_[object]->mutex != mutex) {
+        throw std::invalid_argument(mutex ? "Mutex does not exist" : "Semaphore does not exist");
+    }
+    return *objects_[object];
+}
+
+void LockManager::block(Process* process, uint32_t object, uint64_t timestamp) {
+    if (process->is_queued()) {
+        throw std::runtime_error("Process must be running to block on a lock");
+    }
+    
+    scheduler_.block_process(process);
+    process->set_ready_time(timestamp);
+    objects_[object]->waiters.push(process);
+    
+    Wait& wait = waits_[process->get_pid()];
+    wait.object = object;
+    wait.since = timestamp;
+    wait.inverted = false;
+    stats_.contentions++;
+}
+
+void LockManager::wake(Process* process, uint64_t timestamp) {
+    auto it = waits_.find(process->get_pid());
+    if (it != waits_.end()) {
+        uint64_t blocked = timestamp > it->second.since ? timestamp - it->second.since : 0;
+        stats_.blocking_time += blocked;
+        if (it->second.inverted) {
+            stats_.inversions++;
+            stats_.inversion_time += blocked;
+            stats_.max_inversion_time = std::max(stats_.max_inversion_time, blocked);
+        }
+        waits_.erase(it);
+    }
+    
+    stats_.acquisitions++;
+    scheduler_.add_to_ready_queue(process);
+}
+
+void LockManager::set_priority(Process* process, ProcessPriority priority) {
+    if (process->get_priority() == priority) {
+        return;
+    }
+    scheduler_.set_effective_priority(process, priority);
+    
+    auto it = waits_.find(process->get_pid());
+    if (it == waits_.end()) {
+        return;
+    }
+    
+    // Move within the waiter heap, then pass the change along the chain
+    SyncObject& object = *objects_[it->second.object];
+    object.waiters.update(process);
+    if (object.owner && scheduler_.get_lock_protocol() == LockProtocol::PRIORITY_INHERITANCE) {
+        refresh_priority(object.owner);
+    }
+}
+
+} // namespace osro
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "process.h"
+#include "indexed_heap.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace osro {
+
+class Scheduler;
+
+/**
+ * @brief Protocol bounding priority inversion on mutexes
+ */
+enum class LockProtocol {
+    NONE,                 // Holders keep their own priority
+    PRIORITY_INHERITANCE, // Holders run at the priority of their highest waiter
+    PRIORITY_CEILING      // Holders run at the ceiling of every mutex they hold
+};
+
+/**
+ * @brief Lock system calls a process can make
+ */
+enum class SyncOperation {
+    MUTEX_LOCK,
+    MUTEX_UNLOCK,
+    SEMAPHORE_WAIT,
+    SEMAPHORE_POST
+};
+
+/**
+ * @brief Convert a lock protocol to its display name
+ * @param protocol Protocol to convert
+ * @return const char* Short name
+ */
+const char* to_string(LockProtocol protocol) noexcept;
+
+/**
+ * @brief Convert a lock system call to its name
+ * @param operation Operation to convert
+ * @return const char* System call name
+ */
+const char* to_string(SyncOperation operation) noexcept;
+
+/**
+ * @brief Contention accounting over all mutexes and semaphores
+ */
+struct LockStats {
+    size_t acquisitions = 0;          // Lock and wait operations that succeeded, at once or after blocking
+    size_t contentions = 0;           // Operations that had to block
+    uint64_t blocking_time = 0;       // Time spent blocked on locks in ms
+    size_t inversions = 0;            // Waits behind a holder of lower base priority
+    uint64_t inversion_time = 0;      // Time spent in those waits in ms
+    uint64_t max_inversion_time = 0;  // Longest single inverted wait in ms
+};
+
+/**
+ * @brief Simulated mutexes and counting semaphores
+ *
+ * A process that cannot acquire an object blocks through the scheduler
+ * and waits in the object's waiter heap, which orders waiters by
+ * effective priority and then by arrival. Waiters link through their
+ * queue hook, which is free while they are blocked, so blocking, handing
+ * an object to the next waiter and re-keying a boosted waiter are all
+ * O(log n) in the number of waiters.
+ *
+ * Mutexes are handed directly to the highest-priority waiter on unlock.
+ * The scheduler's lock protocol decides how holders are boosted:
+ * inheritance raises a holder to its highest waiter's priority and
+ * follows the chain when the holder itself waits on another mutex;
+ * ceiling raises a holder to the ceiling of every mutex it holds.
+ * Semaphores have no owner and are never boosted.
+ */
+class LockManager {
+public:
+    /**
+     * @brief Construct an empty lock table
+     * @param scheduler Scheduler that blocks, wakes and re-prioritizes processes
+     */
+    explicit LockManager(Scheduler& scheduler);
+    LockManager(const LockManager&) = delete;
+    LockManager& operator=(const LockManager&) = delete;
+
+    /**
+     * @brief Create a mutex
+     * @param ceiling Highest priority of any process that will lock it
+     * @return uint32_t Object ID
+     */
+    uint32_t create_mutex(ProcessPriority ceiling = ProcessPriority::CRITICAL);
+
+    /**
+     * @brief Create a counting semaphore
+     * @param count Initial number of units
+     * @return uint32_t Object ID
+     */
+    uint32_t create_semaphore(uint64_t count);
+
+    /**
+     * @brief Lock a mutex, blocking the process if it is held
+     * @param process Running process
+     * @param mutex Mutex ID
+     * @param timestamp Current time
+     * @return bool True if acquired, false if the process blocked
+     * @throws std::invalid_argument If the ID is not a mutex
+     * @throws std::runtime_error If the process already holds the mutex
+     */
+    bool lock(Process* process, uint32_t mutex, uint64_t timestamp);
+
+    /**
+     * @brief Unlock a mutex and hand it to the highest-priority waiter
+     * @param process Holder
+     * @param mutex Mutex ID
+     * @param timestamp Current time
+     * @return Process* Waiter that now holds the mutex and is READY, nullptr if none
+     * @throws std::invalid_argument If the ID is not a mutex
+     * @throws std::runtime_error If the process does not hold the mutex
+     */
+    Process* unlock(Process* process, uint32_t mutex, uint64_t timestamp);
+
+    /**
+     * @brief Take a semaphore unit, blocking the process if none is left
+     * @param process Running process
+     * @param semaphore Semaphore ID
+     * @param timestamp Current time
+     * @return bool True if acquired, false if the process blocked
+     * @throws std::invalid_argument If the ID is not a semaphore
+     */
+    bool wait(Process* process, uint32_t semaphore, uint64_t timestamp);
+
+    /**
+     * @brief Return a semaphore unit, waking the highest-priority waiter
+     * @param semaphore Semaphore ID
+     * @param timestamp Current time
+     * @return Process* Waiter that received the unit and is READY, nullptr if none
+     * @throws std::invalid_argument If the ID is not a semaphore
+     */
+    Process* post(uint32_t semaphore, uint64_t timestamp);
+
+    /**
+     * @brief Unlock every mutex a process holds, e.g. when it terminates
+     * @param process Holder
+     * @param timestamp Current time
+     * @return size_t Mutexes released
+     */
+    size_t release_all(Process* process, uint64_t timestamp);
+
+    /**
+     * @brief Get the holder of a mutex
+     * @param mutex Mutex ID
+     * @return Process* Holder, nullptr if unlocked
+     */
+    Process* get_owner(uint32_t mutex) const;
+
+    /**
+     * @brief Get number of processes blocked on an object
+     * @param object Mutex or semaphore ID
+     * @return size_t Waiters
+     */
+    size_t get_waiter_count(uint32_t object) const;
+
+    /**
+     * @brief Recompute a process's effective priority from the locks it holds
+     *
+     * Called after the lock protocol changes or a waiter's priority moves.
+     *
+     * @param process Process to re-prioritize
+     */
+    void refresh_priority(Process* process);
+
+    const LockStats& get_stats() const noexcept { return stats_; }
+
+    /**
+     * @brief Check that no mutex is held and no process is blocked
+     * @return bool True if no process is involved with any lock
+     */
+    bool is_idle() const noexcept { return held_.empty() && waits_.empty(); }
+
+    /**
+     * @brief Check whether a process is blocked on a mutex or semaphore
+     * @param process Process to check
+     * @return bool True if it waits in an object's waiter heap
+     */
+    bool is_waiting(const Process* process) const { return waits_.count(process->get_pid()) != 0; }
+
+    /**
+     * @brief Drop holders, waiters and statistics, restoring base priorities
+     *
+     * Objects and their configuration are kept.
+     */
+    void reset();
+
+private:
+    /**
+     * @brief Waiter order: highest effective priority first, then FIFO
+     */
+    struct WaiterComparator {
+        bool operator()(const Process* a, const Process* b) const {
+            if (a->get_priority() != b->get_priority()) {
+                return a->get_priority() > b->get_priority();
+            }
+            // Blocked processes are not ready, so their ready time records when they started waiting
+            if (a->get_ready_time() != b->get_ready_time()) {
+                return a->get_ready_time() < b->get_ready_time();
+            }
+            return a->get_pid() < b->get_pid();
+        }
+    };
+
+    struct SyncObject {
+        bool mutex = true;
+        Process* owner = nullptr;      // Mutex holder
+        uint64_t count = 0;            // Free semaphore units
+        ProcessPriority ceiling = ProcessPriority::CRITICAL;
+        IndexedHeap<WaiterComparator> waiters;
+    };
+
+    struct Wait {
+        uint32_t object = 0;
+        uint64_t since = 0;
+        bool inverted = false;  // Holder had a lower base priority when the wait began
+    };
+
+    Scheduler& scheduler_;
+    std::vector<std::unique_ptr<SyncObject>> objects_;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> held_;  // PID -> mutexes held
+    std::unordered_map<uint32_t, Wait> waits_;                  // PID -> object waited on
+    LockStats stats_;
+
+    SyncObject& get(uint32_t object, bool mutex);
+    const SyncObject& get(uint32_t object, bool mutex) const;
+
+    /**
+     * @brief Block a process on an object
+     * @param process Running process
+     * @param object Object ID
+     * @param timestamp Current time
+     */
+    void block(Process* process, uint32_t object, uint64_t timestamp);
+
+    /**
+     * @brief Account a finished wait and make the waiter READY
+     * @param process Waiter popped from its object
+     * @param timestamp Current time
+     */
+    void wake(Process* process, uint64_t timestamp);
+
+    /**
+     * @brief Change a process's effective priority and propagate it
+     *
+     * Re-keys the process wherever it is queued and, under inheritance,
+     * passes the change on to the holder of the mutex it waits for.
+     *
+     * @param process Process to change
+     * @param priority New effective priority
+     */
+    void set_priority(Process* process, ProcessPriority priority);
+};
+
+} // namespace osro
@@ -0,0 +1,133 @@
+#include "lottery_queue.h"
+#include <stdexcept>
+
+namespace osro {
+
+LotteryQueue::LotteryQueue(uint32_t seed)
+    : generator_(seed),
+      size_(0) {}
+
+uint64_t LotteryQueue::get_tickets(ProcessPriority priority) noexcept {
+    return static_cast<uint64_t>(priority) * 100;
+}
+
+void LotteryQueue::push(Process* process) {
+    uint64_t tickets = get_tickets(process->get_priority());
+    size_t slot;
+    
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+        slots_[slot] = process;
+        slot_tickets_[slot] = tickets;
+        tickets_.add(slot, tickets);
+    } else {
+        slot = slots_.size();
+        slots_.push_back(process);
+        slot_tickets_.push_back(tickets);
+        tickets_.push_back(tickets);
+    }
+    
+    QueueHook& hook = process->get_queue_hook();
+    hook.slot = slot;
+    hook.owner = this;
+    ++size_;
+}
+
+Process* LotteryQueue::pop() {
+    if (size_ == 0) {
+        return nullptr;
+    }
+    
+    std::uniform_int_distribution<uint64_t> draw(0, tickets_.total() - 1);
+    Process* winner = slots_[tickets_.find(draw(generator_))];
+    erase(winner);
+    return winner;
+}
+
+bool LotteryQueue::erase(Process* process) {
+    if (!contains(process)) {
+        return false;
+    }
+    
+    QueueHook& hook = process->get_queue_hook();
+    size_t slot = hook.slot;
+    tickets_.add(slot, 0 - slot_tickets_[slot]);
+    slot_tickets_[slot] = 0;
+    slots_[slot] = nullptr;
+    free_slots_.push_back(slot);
+    
+    hook.slot = QueueHook::npos;
+    hook.owner = nullptr;
+    --size_;
+    return true;
+}
+
+bool LotteryQueue::update(Process* process) {
+    if (!contains(process)) {
+        return false;
+    }
+    
+    size_t slot = process->get_queue_hook().slot;
+    uint64_t tickets = get_tickets(process->get_priority());
+    tickets_.add(slot, tickets - slot_tickets_[slot]);
+    slot_tickets_[slot] = tickets;
+    return true;
+}
+
+bool LotteryQueue::contains(const Process* process) const noexcept {
+    return process->get_queue_hook().owner == this;
+}
+
+void LotteryQueue::set_layout(size_t slot_count, const std::vector<size_t>& free_slots) {
+    if (size_ != 0) {
+        throw std::runtime_error("Cannot lay out a non-empty lottery queue");
+    }
+    
+    std::vector<bool> free(slot_count, false);
+    for (size_t slot : free_slots) {
+        if (slot >= slot_count || free[slot]) {
+            throw std::invalid_argument("Invalid free lottery slot");
+        }
+        free[slot] = true;
+    }
+    
+    tickets_.clear();
+    slots_.assign(slot_count, nullptr);
+    slot_tickets_.assign(slot_count, 0);
+    for (size_t slot = 0; slot < slot_count; ++slot) {
+        tickets_.push_back(0);
+    }
+    
+    // Occupied slots go on top of the free list, lowest last, so pushes
+    // take them in order and leave exactly the captured free list behind
+    free_slots_ = free_slots;
+    for (size_t slot = slot_count; slot-- > 0;) {
+        if (!free[slot]) {
+            free_slots_.push_back(slot);
+        }
+    }
+}
+
+std::vector<Process*> LotteryQueue::release() {
+    std::vector<Process*> released;
+    released.reserve(size_);
+    
+    for (Process* process : slots_) {
+        if (process) {
+            QueueHook& hook = process->get_queue_hook();
+            hook.slot = QueueHook::npos;
+            hook.owner = nullptr;
+            released.push_back(process);
+        }
+    }
+    
+    tickets_.clear();
+    slots_.clear();
+    slot_tickets_.clear();
+    free_slots_.clear();
+    size_ = 0;
+    return released;
+}
+
+} // namespace osro
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "process.h"
+#include "../utils/fenwick_tree.h"
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Ready queue for lottery scheduling
+ * 
+ * Each queued process occupies a slot whose weight in a Fenwick tree is
+ * its ticket count. Drawing a winner picks a uniformly random ticket and
+ * walks the tree to its owner, so draws and ticket updates are O(log n)
+ * instead of a linear walk over all holders. Freed slots are recycled.
+ */
+class LotteryQueue {
+public:
+    // Stride numerator; stride = kStride1 / tickets
+    static constexpr uint64_t kStride1 = uint64_t{1} << 20;
+
+    /**
+     * @brief Construct a new Lottery Queue
+     * @param seed Seed for deterministic draws
+     */
+    explicit LotteryQueue(uint32_t seed = 42);
+    LotteryQueue(const LotteryQueue&) = delete;
+    LotteryQueue& operator=(const LotteryQueue&) = delete;
+
+    /**
+     * @brief Get ticket allocation of a priority level
+     * @param priority Process priority
+     * @return uint64_t Number of tickets
+     */
+    static uint64_t get_tickets(ProcessPriority priority) noexcept;
+
+    /**
+     * @brief Get the stride scheduling step of a priority level
+     * 
+     * Inversely proportional to the level's tickets, so stride and
+     * lottery scheduling share the same CPU proportions.
+     * 
+     * @param priority Process priority
+     * @return uint64_t Pass advance per millisecond of CPU time
+     */
+    static uint64_t get_stride(ProcessPriority priority) noexcept {
+        return kStride1 / get_tickets(priority);
+    }
+
+    /**
+     * @brief Add a process holding tickets for its priority
+     * @param process Process to add
+     */
+    void push(Process* process);
+
+    /**
+     * @brief Draw a winning process and remove it
+     * @return Process* Winner, nullptr if empty
+     */
+    Process* pop();
+
+    /**
+     * @brief Remove a queued process
+     * @param process Process to remove
+     * @return bool True if the process was queued here
+     */
+    bool erase(Process* process);
+
+    /**
+     * @brief Re-read a queued process's tickets after its priority changed
+     * @param process Process to update
+     * @return bool True if the process was queued here
+     */
+    bool update(Process* process);
+
+    /**
+     * @brief Check whether a process is queued here
+     * @param process Process to look up
+     * @return bool True if queued
+     */
+    bool contains(const Process* process) const noexcept;
+
+    /**
+     * @brief Remove all processes in slot order
+     * @return std::vector<Process*> Previously queued processes
+     */
+    std::vector<Process*> release();
+
+    /**
+     * @brief Get total tickets held by queued processes
+     * @return uint64_t Ticket count
+     */
+    uint64_t get_total_tickets() const noexcept { return tickets_.total(); }
+
+    /**
+     * @brief Get the draw generator, e.g. to resume draws elsewhere
+     * @return const std::mt19937_64& Generator state
+     */
+    const std::mt19937_64& get_generator() const noexcept { return generator_; }
+
+    /**
+     * @brief Replace the draw generator state
+     * @param generator Generator state to continue from
+     */
+    void set_generator(const std::mt19937_64& generator) { generator_ = generator; }
+
+    /**
+     * @brief Get the slot table length, free slots included
+     * @return size_t Slot count
+     */
+    size_t get_slot_count() const noexcept { return slots_.size(); }
+
+    /**
+     * @brief Get the free slots, the next one to be reused last
+     * @return const std::vector<size_t>& Free slot indices
+     */
+    const std::vector<size_t>& get_free_slots() const noexcept { return free_slots_; }
+
+    /**
+     * @brief Lay out the slots of an empty queue as captured elsewhere
+     * 
+     * The pushes that follow fill the slots that are not free in
+     * ascending order, so pushing the captured holders in slot order
+     * reproduces the captured ticket layout, and with it every draw.
+     * 
+     * @param slot_count Captured get_slot_count()
+     * @param free_slots Captured get_free_slots()
+     * @throws std::runtime_error If the queue is not empty
+     * @throws std::invalid_argument If a free slot is out of range or repeated
+     */
+    void set_layout(size_t slot_count, const std::vector<size_t>& free_slots);
+
+    /**
+     * @brief Visit every ticket holder in slot order
+     * @param visit Callable taking Process*
+     */
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const {
+        for (Process* process : slots_) {
+            if (process) {
+                visit(process);
+            }
+        }
+    }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+private:
+    FenwickTree<uint64_t> tickets_;
+    std::vector<Process*> slots_;
+    std::vector<uint64_t> slot_tickets_;
+    std::vector<size_t> free_slots_;
+    std::mt19937_64 generator_;
+    size_t size_;
+};
+
+} // namespace osro
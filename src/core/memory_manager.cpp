@@ -34,25 +34,27 @@ uint64_t MemoryManager::allocate(uint32_t process_id, uint64_t size) {
         return 0; // Request exceeds total memory
     }
     
-    size_t block_index = SIZE_MAX;
+    uint64_t address = SegregatedFreeList::kNotFound;
     
     switch (strategy_) {
         case AllocationStrategy::FIRST_FIT:
-            block_index = find_first_fit(size);
+            address = find_first_fit(size);
             break;
         case AllocationStrategy::BEST_FIT:
-            block_index = find_best_fit(size);
+            address = find_best_fit(size);
             break;
         case AllocationStrategy::WORST_FIT:
-            block_index = find_worst_fit(size);
+            address = find_worst_fit(size);
             break;
     }
     
-    if (block_index == SIZE_MAX) {
+    if (address == SegregatedFreeList::kNotFound) {
         return 0; // No suitable block found
     }
     
-    MemoryBlock& block = memory_blocks_[block_index];
+    auto block_it = memory_blocks_.find(address);
+    MemoryBlock& block = block_it->second;
+    free_list_.erase(block.address, block.size);
     
     // Mark block as allocated
     block.is_allocated = true;
@@ -60,32 +62,28 @@ uint64_t MemoryManager::allocate(uint32_t process_id, uint64_t size) {
     
     // Split block if necessary
     if (block.size > size) {
-        split_block(block_index, size);
+        split_block(block_it, size);
     }
     
     // Create virtual address mapping
-    VirtualAddress vaddr(block.address, page_size_);
+    VirtualAddress vaddr(address, page_size_);
     
     // Update process allocations
     process_allocations_[process_id].push_back(vaddr);
     
-    return block.address;
+    return address;
 }
 
 bool MemoryManager::deallocate(uint32_t process_id, uint64_t virtual_address) {
     // Find the memory block
-    auto it = std::find_if(memory_blocks_.begin(), memory_blocks_.end(),
-                          [virtual_address](const MemoryBlock& block) {
-                              return block.address == virtual_address && block.is_allocated;
-                          });
-    
-    if (it == memory_blocks_.end()) {
+    auto block_it = memory_blocks_.find(virtual_address);
+    if (block_it == memory_blocks_.end() || !block_it->second.is_allocated) {
         return false; // Block not found or not allocated
     }
     
     // Mark as free
-    it->is_allocated = false;
-    it->process_id = 0;
+    block_it->second.is_allocated = false;
+    block_it->second.process_id = 0;
     
     // Remove from process allocations
     auto proc_it = process_allocations_.find(process_id);
@@ -105,8 +103,8 @@ bool MemoryManager::deallocate(uint32_t process_id, uint64_t virtual_address) {
         }
     }
     
-    // Coalesce adjacent free blocks
-    coalesce_blocks();
+    // Merge with free neighbors and index the result
+    coalesce_blocks(block_it);
     
     return true;
 }
@@ -121,12 +119,7 @@ double MemoryManager::get_fragmentation() const {
     if (total_free == 0) return 0.0;
     
     // Find largest contiguous free block
-    uint64_t largest_free = 0;
-    for (const auto& block : memory_blocks_) {
-        if (!block.is_allocated && block.size > largest_free) {
-            largest_free = block.size;
-        }
-    }
+    uint64_t largest_free = free_list_.get_largest();
     
     if (largest_free == 0) return 1.0; // Completely fragmented
     
@@ -137,30 +130,35 @@ size_t MemoryManager::garbage_collect() {
     size_t compacted = 0;
     
     // Simple defragmentation: move all allocated blocks to beginning
-    size_t write_index = 0;
-    for (size_t i = 0; i < memory_blocks_.size(); ++i) {
-        if (memory_blocks_[i].is_allocated) {
-            if (write_index != i) {
+    bool moved = false;
+    for (auto it = memory_blocks_.begin(); it != memory_blocks_.end(); ) {
+        if (it->second.is_allocated) {
+            if (moved) {
                 // Move block
-                memory_blocks_[write_index] = memory_blocks_[i];
-                compacted += memory_blocks_[i].size;
+                compacted += it->second.size;
             }
-            ++write_index;
+            ++it;
+        } else {
+            moved = true;
+            it = memory_blocks_.erase(it);
         }
     }
     
     // Create single free block at the end
-    if (write_index < memory_blocks_.size()) {
-        uint64_t free_start = (write_index > 0) ? 
-            memory_blocks_[write_index - 1].address + memory_blocks_[write_index - 1].size : 0;
+    if (moved) {
+        uint64_t free_start = 0;
+        if (!memory_blocks_.empty()) {
+            const MemoryBlock& last = std::prev(memory_blocks_.end())->second;
+            free_start = last.address + last.size;
+        }
         uint64_t free_size = total_memory_ - free_start;
         
-        memory_blocks_.erase(memory_blocks_.begin() + static_cast<ptrdiff_t>(write_index),
-                             memory_blocks_.end());
-        memory_blocks_.emplace_back(free_start, free_size);
-        memory_blocks_.back().is_allocated = false;
-        memory_blocks_.back().process_id = 0;
+        // Allocations may already reach the end of memory
+        if (free_size > 0) {
+            memory_blocks_.emplace_hint(memory_blocks_.end(), free_start, MemoryBlock(free_start, free_size));
+        }
     }
+    rebuild_free_list();
     
     return compacted;
 }
@@ -170,16 +168,13 @@ uint64_t MemoryManager::get_total_memory() const noexcept {
 }
 
 uint64_t MemoryManager::get_free_memory() const noexcept {
-    return std::accumulate(memory_blocks_.begin(), memory_blocks_.end(), 0ULL,
-                          [](uint64_t sum, const MemoryBlock& block) {
-                              return sum + (!block.is_allocated ? block.size : 0);
-                          });
+    return free_list_.get_free_bytes();
 }
 
 uint64_t MemoryManager::get_allocated_memory() const noexcept {
     return std::accumulate(memory_blocks_.begin(), memory_blocks_.end(), 0ULL,
-                          [](uint64_t sum, const MemoryBlock& block) {
-                              return sum + (block.is_allocated ? block.size : 0);
+                          [](uint64_t sum, const BlockMap::value_type& entry) {
+                              return sum + (entry.second.is_allocated ? entry.second.size : 0);
                           });
 }
 
@@ -190,16 +185,17 @@ size_t MemoryManager::deallocate_all(uint32_t process_id) {
     }
 
     size_t freed = 0;
-    for (auto& block : memory_blocks_) {
+    for (auto it = memory_blocks_.begin(); it != memory_blocks_.end(); ++it) {
+        MemoryBlock& block = it->second;
         if (block.is_allocated && block.process_id == process_id) {
             block.is_allocated = false;
             block.process_id = 0;
             freed += block.size;
+            it = coalesce_blocks(it);
         }
     }
 
     process_allocations_.erase(proc_it);
-    coalesce_blocks();
 
     return freed;
 }
@@ -214,55 +210,28 @@ void MemoryManager::reset() {
 }
 
 std::vector<MemoryBlock> MemoryManager::get_memory_map() const {
-    return memory_blocks_;
+    std::vector<MemoryBlock> blocks;
+    blocks.reserve(memory_blocks_.size());
+    for (const auto& entry : memory_blocks_) {
+        blocks.push_back(entry.second);
+    }
+    return blocks;
 }
 
-size_t MemoryManager::find_best_fit(uint64_t size) const {
-    size_t best_index = SIZE_MAX;
-    uint64_t best_size = UINT64_MAX;
-    
-    for (size_t i = 0; i < memory_blocks_.size(); ++i) {
-        const auto& block = memory_blocks_[i];
-        if (!block.is_allocated && block.size >= size) {
-            if (block.size < best_size) {
-                best_size = block.size;
-                best_index = i;
-            }
-        }
-    }
-    
-    return best_index;
+uint64_t MemoryManager::find_best_fit(uint64_t size) const {
+    return free_list_.find_best_fit(size);
 }
 
-size_t MemoryManager::find_first_fit(uint64_t size) const {
-    for (size_t i = 0; i < memory_blocks_.size(); ++i) {
-        const auto& block = memory_blocks_[i];
-        if (!block.is_allocated && block.size >= size) {
-            return i;
-        }
-    }
-    return SIZE_MAX;
+uint64_t MemoryManager::find_first_fit(uint64_t size) const {
+    return free_list_.find_first_fit(size);
 }
 
-size_t MemoryManager::find_worst_fit(uint64_t size) const {
-    size_t worst_index = SIZE_MAX;
-    uint64_t worst_size = 0;
-    
-    for (size_t i = 0; i < memory_blocks_.size(); ++i) {
-        const auto& block = memory_blocks_[i];
-        if (!block.is_allocated && block.size >= size) {
-            if (block.size > worst_size) {
-                worst_size = block.size;
-                worst_index = i;
-            }
-        }
-    }
-    
-    return worst_index;
+uint64_t MemoryManager::find_worst_fit(uint64_t size) const {
+    return free_list_.find_worst_fit(size);
 }
 
-void MemoryManager::split_block(size_t block_index, uint64_t size) {
-    MemoryBlock& block = memory_blocks_[block_index];
+void MemoryManager::split_block(BlockMap::iterator block_it, uint64_t size) {
+    MemoryBlock& block = block_it->second;
     uint64_t remaining_size = block.size - size;
     
     if (remaining_size < page_size_) {
@@ -276,30 +245,51 @@ void MemoryManager::split_block(size_t block_index, uint64_t size) {
     // Update current block
     block.size = size;
     
-    // Insert new block
-    memory_blocks_.insert(memory_blocks_.begin() + block_index + 1, new_block);
+    // Insert new block; the block it was cut from was free, so its
+    // right neighbor is allocated and there is nothing to merge
+    memory_blocks_.emplace_hint(std::next(block_it), new_block.address, new_block);
+    free_list_.insert(new_block.address, new_block.size);
 }
 
-void MemoryManager::coalesce_blocks() {
-    for (size_t i = 0; i < memory_blocks_.size() - 1; ) {
-        MemoryBlock& current = memory_blocks_[i];
-        MemoryBlock& next = memory_blocks_[i + 1];
-        
-        if (!current.is_allocated && !next.is_allocated) {
-            // Merge adjacent free blocks
-            current.size += next.size;
-            memory_blocks_.erase(memory_blocks_.begin() + i + 1);
-        } else {
-            ++i;
+MemoryManager::BlockMap::iterator MemoryManager::coalesce_blocks(BlockMap::iterator block_it) {
+    MemoryBlock& block = block_it->second;
+    
+    // Free blocks are always merged, so at most one free block sits on
+    // either side of the newly freed one
+    auto next = std::next(block_it);
+    if (next != memory_blocks_.end() && !next->second.is_allocated) {
+        free_list_.erase(next->second.address, next->second.size);
+        block.size += next->second.size;
+        memory_blocks_.erase(next);
+    }
+    
+    if (block_it != memory_blocks_.begin()) {
+        auto prev = std::prev(block_it);
+        if (!prev->second.is_allocated) {
+            free_list_.erase(prev->second.address, prev->second.size);
+            prev->second.size += block.size;
+            memory_blocks_.erase(block_it);
+            block_it = prev;
         }
     }
+    
+    free_list_.insert(block_it->second.address, block_it->second.size);
+    return block_it;
 }
 
 void MemoryManager::initialize_memory() {
     memory_blocks_.clear();
-    memory_blocks_.emplace_back(0, total_memory_);
-    memory_blocks_[0].is_allocated = false;
-    memory_blocks_[0].process_id = 0;
+    memory_blocks_.emplace(0, MemoryBlock(0, total_memory_));
+    rebuild_free_list();
+}
+
+void MemoryManager::rebuild_free_list() {
+    free_list_.clear();
+    for (const auto& entry : memory_blocks_) {
+        if (!entry.second.is_allocated) {
+            free_list_.insert(entry.second.address, entry.second.size);
+        }
+    }
 }
 
 } // namespace osro
\ No newline at end of file
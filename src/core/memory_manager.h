@@ -1,6 +1,8 @@
 #pragma once
 
+#include "segregated_free_list.h"
 #include <cstdint>
+#include <map>
 #include <vector>
 #include <memory>
 #include <unordered_map>
@@ -37,6 +39,11 @@ struct MemoryBlock {
  * paging with virtual-to-physical address translation. It demonstrates
  * core memory management concepts including fragmentation, garbage
  * collection, and defragmentation.
+ * 
+ * The memory map is a balanced tree ordered by address, so splitting
+ * a block and merging a freed block with its neighbors are O(log n).
+ * Free blocks are also indexed by size in a SegregatedFreeList, so the
+ * fit strategies find a block without scanning the memory map.
  */
 class MemoryManager {
 public:
@@ -143,51 +150,61 @@ private:
         PageTableEntry() : physical_address(0), valid(false), process_id(0) {}
     };
 
+    using BlockMap = std::map<uint64_t, MemoryBlock>;  // Keyed by address
+
     uint64_t total_memory_;
     uint64_t page_size_;
     AllocationStrategy strategy_;
     
-    std::vector<MemoryBlock> memory_blocks_;
+    BlockMap memory_blocks_;
+    SegregatedFreeList free_list_;
     std::unordered_map<uint32_t, std::vector<VirtualAddress>> process_allocations_;
     std::vector<PageTableEntry> page_table_;
     
     /**
      * @brief Find best fit block for allocation
      * @param size Required size
-     * @return size_t Index of best block, SIZE_MAX if none found
+     * @return uint64_t Address of best block, SegregatedFreeList::kNotFound if none found
      */
-    size_t find_best_fit(uint64_t size) const;
+    uint64_t find_best_fit(uint64_t size) const;
 
     /**
      * @brief Find first fit block for allocation
      * @param size Required size
-     * @return size_t Index of first block, SIZE_MAX if none found
+     * @return uint64_t Address of first block, SegregatedFreeList::kNotFound if none found
      */
-    size_t find_first_fit(uint64_t size) const;
+    uint64_t find_first_fit(uint64_t size) const;
 
     /**
      * @brief Find worst fit block for allocation
      * @param size Required size
-     * @return size_t Index of worst block, SIZE_MAX if none found
+     * @return uint64_t Address of worst block, SegregatedFreeList::kNotFound if none found
      */
-    size_t find_worst_fit(uint64_t size) const;
+    uint64_t find_worst_fit(uint64_t size) const;
 
     /**
      * @brief Split a memory block
-     * @param block_index Index of block to split
+     * @param block_it Block to split
      * @param size Size to allocate
      */
-    void split_block(size_t block_index, uint64_t size);
+    void split_block(BlockMap::iterator block_it, uint64_t size);
 
     /**
-     * @brief Coalesce adjacent free blocks
+     * @brief Merge a newly freed block with its free neighbors
+     * @param block_it Freed block, not yet in the free list
+     * @return BlockMap::iterator Merged block, now in the free list
      */
-    void coalesce_blocks();
+    BlockMap::iterator coalesce_blocks(BlockMap::iterator block_it);
 
     /**
      * @brief Initialize memory blocks
      */
     void initialize_memory();
+
+    /**
+     * @brief Re-index every free block of the memory map
+     */
+    void rebuild_free_list();
 };
 
 } // namespace osro
\ No newline at end of file
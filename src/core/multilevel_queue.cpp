@@ -0,0 +1,92 @@
+#include "multilevel_queue.h"
+#include "../utils/bit_ops.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace osro {
+
+MultilevelQueue::MultilevelQueue(size_t levels)
+    : occupancy_(0),
+      level_count_(0),
+      size_(0) {
+    set_level_count(levels);
+}
+
+void MultilevelQueue::push(Process* process) {
+    size_t level = std::min<size_t>(process->get_queue_level(), level_count_ - 1);
+    process->set_queue_level(static_cast<uint32_t>(level));
+    
+    levels_[level].push_back(process);
+    occupancy_ |= (uint64_t{1} << level);
+    ++size_;
+}
+
+Process* MultilevelQueue::pop() {
+    if (occupancy_ == 0) {
+        return nullptr;
+    }
+    
+    unsigned level = find_first_set(occupancy_);
+    Process* process = levels_[level].pop_front();
+    if (levels_[level].empty()) {
+        occupancy_ &= ~(uint64_t{1} << level);
+    }
+    --size_;
+    return process;
+}
+
+bool MultilevelQueue::erase(Process* process) {
+    uint32_t level = process->get_queue_level();
+    if (level >= level_count_ || !levels_[level].erase(process)) {
+        return false;
+    }
+    
+    if (levels_[level].empty()) {
+        occupancy_ &= ~(uint64_t{1} << level);
+    }
+    --size_;
+    return true;
+}
+
+bool MultilevelQueue::contains(const Process* process) const noexcept {
+    uint32_t level = process->get_queue_level();
+    return level < level_count_ && levels_[level].contains(process);
+}
+
+void MultilevelQueue::boost() {
+    for (size_t level = 1; level < level_count_; ++level) {
+        while (Process* process = levels_[level].pop_front()) {
+            process->set_queue_level(0);
+            levels_[0].push_back(process);
+        }
+    }
+    
+    occupancy_ = levels_[0].empty() ? 0 : 1;
+}
+
+std::vector<Process*> MultilevelQueue::release() {
+    std::vector<Process*> released;
+    released.reserve(size_);
+    
+    for (size_t level = 0; level < level_count_; ++level) {
+        while (Process* process = levels_[level].pop_front()) {
+            released.push_back(process);
+        }
+    }
+    
+    occupancy_ = 0;
+    size_ = 0;
+    return released;
+}
+
+void MultilevelQueue::set_level_count(size_t levels) {
+    if (levels == 0 || levels > kMaxLevels) {
+        throw std::invalid_argument("MLFQ level count must be between 1 and 64");
+    }
+    if (!empty()) {
+        throw std::logic_error("Cannot change MLFQ level count while processes are queued");
+    }
+    level_count_ = levels;
+}
+
+} // namespace osro
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "process.h"
+#include "process_list.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Bitmap-indexed array of FIFO levels for MLFQ scheduling
+ * 
+ * Each level is an intrusive FIFO list and bit i of the occupancy
+ * bitmap is set while level i is non-empty, so picking the next
+ * process is a find-first-set followed by a list pop, both O(1)
+ * regardless of how many processes are queued (as in the Linux O(1)
+ * scheduler). Level 0 has the highest priority.
+ */
+class MultilevelQueue {
+public:
+    static constexpr size_t kMaxLevels = 64;
+    static constexpr size_t kDefaultLevels = 8;
+
+    // Time between priority boosts unless configured otherwise
+    static constexpr uint64_t kDefaultBoostInterval = 1000;
+
+    // Cap on the quantum doubling so deep levels cannot overflow
+    static constexpr uint32_t kMaxQuantumShift = 16;
+
+    /**
+     * @brief Get the quantum of a level; it doubles at every level
+     * @param base Quantum of level 0 in milliseconds
+     * @param level Queue level
+     * @return uint64_t Quantum in milliseconds
+     */
+    static uint64_t get_time_slice(uint64_t base, uint32_t level) noexcept {
+        return base << std::min(level, kMaxQuantumShift);
+    }
+
+    /**
+     * @brief Construct a new Multilevel Queue
+     * @param levels Number of priority levels (1 to kMaxLevels)
+     */
+    explicit MultilevelQueue(size_t levels = kDefaultLevels);
+
+    /**
+     * @brief Enqueue a process at the tail of its current queue level
+     * @param process Process to enqueue
+     */
+    void push(Process* process);
+
+    /**
+     * @brief Dequeue the head of the highest non-empty level
+     * @return Process* Dequeued process, nullptr if empty
+     */
+    Process* pop();
+
+    /**
+     * @brief Remove a queued process
+     * @param process Process to remove
+     * @return bool True if the process was queued here
+     */
+    bool erase(Process* process);
+
+    /**
+     * @brief Check whether a process is queued here
+     * @param process Process to look up
+     * @return bool True if queued
+     */
+    bool contains(const Process* process) const noexcept;
+
+    /**
+     * @brief Move every queued process to level 0, keeping level order
+     */
+    void boost();
+
+    /**
+     * @brief Remove all processes, highest level first
+     * @return std::vector<Process*> Previously queued processes
+     */
+    std::vector<Process*> release();
+
+    /**
+     * @brief Change the number of levels (queue must be empty)
+     * @param levels Number of priority levels (1 to kMaxLevels)
+     */
+    void set_level_count(size_t levels);
+
+    /**
+     * @brief Visit every process, highest level first
+     * @param visit Callable taking Process*
+     */
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const {
+        for (size_t level = 0; level < level_count_; ++level) {
+            levels_[level].for_each(visit);
+        }
+    }
+
+    size_t get_level_count() const noexcept { return level_count_; }
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+private:
+    std::array<ProcessList, kMaxLevels> levels_;
+    uint64_t occupancy_;
+    size_t level_count_;
+    size_t size_;
+};
+
+} // namespace osro
@@ -0,0 +1,191 @@
+#include "parallel_executor.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace osro {
+
+ParallelExecutor::ParallelExecutor(size_t cores, uint64_t epoch_length, uint64_t time_slice)
+    : epoch_length_(epoch_length),
+      time_slice_(time_slice),
+      epoch_start_(0),
+      epoch_end_(0),
+      simulation_time_(0),
+      stopped_(false) {
+    
+    if (cores == 0) {
+        throw std::invalid_argument("Core count must be greater than 0");
+    }
+    if (epoch_length == 0) {
+        throw std::invalid_argument("Epoch length must be greater than 0");
+    }
+    if (time_slice == 0) {
+        throw std::invalid_argument("Time slice must be greater than 0");
+    }
+    
+    cores_.reserve(cores);
+    for (size_t core = 0; core < cores; ++core) {
+        cores_.push_back(std::make_unique<CoreContext>());
+        cores_.back()->random_state = 0x9E3779B97F4A7C15ULL * (core + 1);
+    }
+}
+
+void ParallelExecutor::submit(Process* process) {
+    if (!process) {
+        return;
+    }
+    
+    size_t best = 0;
+    for (size_t core = 1; core < cores_.size(); ++core) {
+        if (cores_[core]->deque.size() < cores_[best]->deque.size()) {
+            best = core;
+        }
+    }
+    
+    process->set_state(ProcessState::READY);
+    process->set_core(static_cast<uint32_t>(best));
+    cores_[best]->deque.push(process);
+}
+
+void ParallelExecutor::run(uint64_t simulation_time, const EpochCallback& on_epoch) {
+    simulation_time_ = simulation_time;
+    epoch_start_ = 0;
+    epoch_end_ = 0;
+    stopped_ = false;
+    error_ = nullptr;
+    
+    // Time 0 admissions happen before any thread starts
+    finish_epoch(on_epoch);
+    
+    EpochBarrier barrier(cores_.size(), [this, &on_epoch] { finish_epoch(on_epoch); });
+    
+    std::vector<std::thread> threads;
+    threads.reserve(cores_.size());
+    for (size_t core = 0; core < cores_.size(); ++core) {
+        threads.emplace_back(&ParallelExecutor::run_core, this, core, std::ref(barrier));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+}
+
+std::vector<Process*> ParallelExecutor::take_completed() {
+    std::vector<Process*> completed;
+    for (auto& context : cores_) {
+        completed.insert(completed.end(), context->completed.begin(), context->completed.end());
+        context->completed.clear();
+    }
+    return completed;
+}
+
+const CoreStats& ParallelExecutor::get_core_stats(size_t core) const {
+    if (core >= cores_.size()) {
+        throw std::out_of_range("Core index out of range");
+    }
+    return cores_[core]->stats;
+}
+
+size_t ParallelExecutor::get_queued_count() const noexcept {
+    size_t total = 0;
+    for (const auto& context : cores_) {
+        total += context->deque.size();
+    }
+    return total;
+}
+
+void ParallelExecutor::run_core(size_t core, EpochBarrier& barrier) {
+    CoreContext& context = *cores_[core];
+    
+    // Epoch bounds and the stop flag only change inside the barrier
+    while (!stopped_) {
+        uint64_t clock = epoch_start_;
+        
+        while (clock < epoch_end_) {
+            // Serve the local queue oldest first, the end thieves take from, so
+            // processes expired last epoch wait behind the ones that did not run
+            Process* process = nullptr;
+            if (!context.deque.steal(process) && !steal(core, process)) {
+                break; // Idle for the rest of the epoch
+            }
+            
+            if (process->get_core() != core) {
+                context.stats.migrations++;
+                process->set_core(static_cast<uint32_t>(core));
+            }
+            context.stats.dispatches++;
+            
+            // The last slice of an epoch is cut short at the boundary
+            uint64_t slice = std::min(time_slice_, epoch_end_ - clock);
+            uint64_t runtime = std::min(slice, process->get_remaining_time());
+            process->set_state(ProcessState::RUNNING);
+            bool completed = process->execute(slice);
+            clock += runtime;
+            context.stats.busy_time += runtime;
+            
+            if (completed) {
+                process->set_state(ProcessState::TERMINATED);
+                process->set_completion_time(clock);
+                context.completed.push_back(process);
+            } else {
+                process->set_state(ProcessState::READY);
+                context.expired.push_back(process);
+            }
+        }
+        
+        barrier.arrive_and_wait();
+    }
+}
+
+bool ParallelExecutor::steal(size_t core, Process*& process) {
+    const size_t count = cores_.size();
+    if (count < 2) {
+        return false;
+    }
+    
+    CoreContext& context = *cores_[core];
+    uint64_t& state = context.random_state;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    
+    // Visit every other core once, starting at a random victim
+    size_t start = static_cast<size_t>(state % count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t victim = (start + i) % count;
+        if (victim != core && cores_[victim]->deque.steal(process)) {
+            context.stats.steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ParallelExecutor::finish_epoch(const EpochCallback& on_epoch) noexcept {
+    epoch_start_ = epoch_end_;
+    
+    // Every core is parked, so no core can run an expired process again in
+    // the epoch that expired it
+    for (auto& context : cores_) {
+        for (Process* process : context->expired) {
+            context->deque.push(process);
+        }
+        context->expired.clear();
+    }
+    
+    if (on_epoch && !error_) {
+        try {
+            on_epoch(epoch_start_);
+        } catch (...) {
+            error_ = std::current_exception();
+        }
+    }
+    
+    epoch_end_ = std::min(epoch_start_ + epoch_length_, simulation_time_);
+    stopped_ = error_ != nullptr || epoch_start_ >= simulation_time_;
+}
+
+} // namespace osro
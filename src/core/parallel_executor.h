@@ -0,0 +1,139 @@
+#pragma once
+
+#include "process.h"
+#include "scheduler.h"
+#include "../utils/epoch_barrier.h"
+#include "../utils/work_stealing_deque.h"
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Drives simulated cores on real host threads
+ * 
+ * Each simulated core runs on its own host thread and keeps its runnable
+ * processes in a Chase-Lev deque. Within an epoch a core runs processes
+ * for one time slice each, oldest first, until its simulated clock
+ * reaches the epoch end; a core that runs dry steals from the others.
+ * Preempted processes are parked locally. All threads then meet at an
+ * epoch barrier whose serial step re-queues the parked processes,
+ * advances simulated time and runs the caller's epoch callback, which
+ * may submit arrivals and drain completions without any further
+ * locking. A process therefore runs at most one slice per epoch, and
+ * never on two cores at overlapping simulated times.
+ */
+class ParallelExecutor {
+public:
+    /**
+     * @brief Callback run serially between epochs
+     * @param current_time Simulated time at the end of the epoch
+     */
+    using EpochCallback = std::function<void(uint64_t current_time)>;
+
+    /**
+     * @brief Construct a new Parallel Executor
+     * @param cores Number of simulated cores (one host thread each)
+     * @param epoch_length Simulated milliseconds between barriers
+     * @param time_slice Time slice per dispatch in milliseconds
+     */
+    ParallelExecutor(size_t cores, uint64_t epoch_length, uint64_t time_slice = 10);
+    ParallelExecutor(const ParallelExecutor&) = delete;
+    ParallelExecutor& operator=(const ParallelExecutor&) = delete;
+
+    /**
+     * @brief Queue a runnable process on the least loaded core
+     * 
+     * Only valid before run() or from inside the epoch callback.
+     * 
+     * @param process Process to queue
+     */
+    void submit(Process* process);
+
+    /**
+     * @brief Run the simulation on host threads
+     * 
+     * The callback runs once before the first epoch (at time 0) and after
+     * every epoch. Exceptions thrown by the callback stop the run and are
+     * rethrown once all threads have joined.
+     * 
+     * @param simulation_time Simulated duration in milliseconds
+     * @param on_epoch Serial step between epochs (may be empty)
+     */
+    void run(uint64_t simulation_time, const EpochCallback& on_epoch);
+
+    /**
+     * @brief Take processes completed since the last call
+     * 
+     * Only valid outside run() or from inside the epoch callback.
+     * 
+     * @return std::vector<Process*> Completed processes
+     */
+    std::vector<Process*> take_completed();
+
+    /**
+     * @brief Get statistics of one simulated core
+     * @param core Core index
+     * @return const CoreStats& Core statistics
+     */
+    const CoreStats& get_core_stats(size_t core) const;
+
+    size_t get_core_count() const noexcept { return cores_.size(); }
+    uint64_t get_epoch_length() const noexcept { return epoch_length_; }
+    uint64_t get_current_time() const noexcept { return epoch_start_; }
+
+    /**
+     * @brief Get number of processes queued on all cores (quiescent only)
+     * @return size_t Queued processes
+     */
+    size_t get_queued_count() const noexcept;
+
+private:
+    /**
+     * @brief Per-core state, cache-line aligned to avoid false sharing
+     */
+    struct alignas(64) CoreContext {
+        WorkStealingDeque<Process*> deque;
+        std::vector<Process*> expired;   // Preempted this epoch, re-queued after the barrier
+        std::vector<Process*> completed; // Finished, drained by take_completed()
+        CoreStats stats;
+        uint64_t random_state;           // Victim selection (xorshift)
+    };
+
+    std::vector<std::unique_ptr<CoreContext>> cores_;
+    uint64_t epoch_length_;
+    uint64_t time_slice_;
+    uint64_t epoch_start_;
+    uint64_t epoch_end_;
+    uint64_t simulation_time_;
+    bool stopped_;
+    std::exception_ptr error_;
+
+    /**
+     * @brief Thread body of one simulated core
+     * @param core Core index
+     * @param barrier Barrier shared by all core threads
+     */
+    void run_core(size_t core, EpochBarrier& barrier);
+
+    /**
+     * @brief Steal a process from another core
+     * @param core Core looking for work
+     * @param process Receives the stolen process
+     * @return bool True if a process was stolen
+     */
+    bool steal(size_t core, Process*& process);
+
+    /**
+     * @brief Serial step between epochs: re-queue expired processes, then
+     *        advance time and run the callback
+     * @param on_epoch Caller's epoch callback
+     */
+    void finish_epoch(const EpochCallback& on_epoch) noexcept;
+};
+
+} // namespace osro
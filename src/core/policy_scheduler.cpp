@@ -0,0 +1,25 @@
+#include "policy_scheduler.h"
+#include <string>
+
+namespace osro {
+
+AnyPolicyScheduler make_policy_scheduler(SchedulingAlgorithm algorithm, uint64_t time_slice) {
+    switch (algorithm) {
+        case SchedulingAlgorithm::ROUND_ROBIN:
+            return AnyPolicyScheduler::create<RoundRobinPolicy>(time_slice);
+        case SchedulingAlgorithm::PRIORITY:
+            return AnyPolicyScheduler::create<PriorityPolicy>(time_slice);
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+            return AnyPolicyScheduler::create<ShortestJobPolicy>(time_slice);
+        case SchedulingAlgorithm::MLFQ:
+            return AnyPolicyScheduler::create<MlfqPolicy>(time_slice);
+        case SchedulingAlgorithm::EDF:
+            return AnyPolicyScheduler::create<DeadlinePolicy>(time_slice);
+        case SchedulingAlgorithm::STRIDE:
+            return AnyPolicyScheduler::create<StridePolicy>(time_slice);
+        default:
+            throw std::invalid_argument(std::string("No static policy for ") + to_string(algorithm));
+    }
+}
+
+} // namespace osro
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "process.h"
+#include "scheduler.h"
+#include "scheduling_policy.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace osro {
+
+/**
+ * @brief Single-core scheduler whose policy is fixed at compile time
+ *
+ * Every queue operation and hook goes straight to Policy, so the
+ * compiler can inline a policy's whole dispatch path without any
+ * algorithm switch. Use it directly when the policy is known, or
+ * through AnyPolicyScheduler when it is chosen at run time.
+ *
+ * @tparam Policy Scheduling policy (see PolicyHooks)
+ */
+template<typename Policy>
+class PolicyScheduler {
+public:
+    /**
+     * @brief Construct a new Policy Scheduler
+     * @param time_slice Base time slice in milliseconds
+     */
+    explicit PolicyScheduler(uint64_t time_slice = 10) : time_slice_(time_slice) {
+        if (time_slice == 0) {
+            throw std::invalid_argument("Time slice must be greater than 0");
+        }
+    }
+
+    PolicyScheduler(const PolicyScheduler&) = delete;
+    PolicyScheduler& operator=(const PolicyScheduler&) = delete;
+
+    static constexpr const char* get_name() noexcept { return Policy::kName; }
+
+    /**
+     * @brief Add process to the ready queue
+     * @param process Process to add
+     * @return bool False if process is null
+     */
+    bool add_to_ready_queue(Process* process) {
+        if (!process) {
+            return false;
+        }
+        if (process->is_queued()) {
+            return true;
+        }
+
+        ProcessState previous = process->get_state();
+        process->set_state(ProcessState::READY);
+        policy_.on_enqueue(process, current_time_);
+        policy_.push(process);
+        record(process, previous, ProcessState::READY);
+        return true;
+    }
+
+    /**
+     * @brief Dispatch the process the policy runs next
+     * @return Process* Process to execute, nullptr if the queue is empty
+     */
+    Process* get_next_process() {
+        Process* process = policy_.pop();
+        if (process) {
+            dispatches_++;
+            process->set_state(ProcessState::RUNNING);
+            record(process, ProcessState::READY, ProcessState::RUNNING);
+        }
+        return process;
+    }
+
+    /**
+     * @brief Remove a queued process
+     * @param process Process to remove
+     * @return bool True if the process was queued
+     */
+    bool remove_from_ready_queue(Process* process) {
+        return process && policy_.erase(process);
+    }
+
+    /**
+     * @brief Get the time slice granted to a process on its next dispatch
+     * @param process Process about to run
+     * @return uint64_t Time slice in milliseconds
+     */
+    uint64_t get_time_slice(const Process* process) const {
+        return process ? policy_.time_slice(process, time_slice_) : time_slice_;
+    }
+
+    /**
+     * @brief Charge CPU time consumed by a process in its last dispatch
+     * @param process Process that ran
+     * @param runtime CPU time consumed in milliseconds
+     */
+    void account_runtime(Process* process, uint64_t runtime) {
+        if (process) {
+            policy_.on_run(process, runtime, get_time_slice(process));
+        }
+    }
+
+    /**
+     * @brief Advance scheduler time and run the policy's periodic work
+     * @param current_time Current simulation time in milliseconds
+     */
+    void tick(uint64_t current_time) {
+        current_time_ = current_time;
+        policy_.on_tick(current_time);
+    }
+
+    size_t get_ready_queue_size() const noexcept { return policy_.size(); }
+    size_t get_dispatch_count() const noexcept { return dispatches_; }
+    const SchedulerRecorder& get_recorder() const noexcept { return recorder_; }
+
+    /**
+     * @brief Access the policy (for policy-specific configuration)
+     * @return Policy& Policy instance
+     */
+    Policy& get_policy() noexcept { return policy_; }
+
+    /**
+     * @brief Drop all queued processes and statistics
+     */
+    void reset() {
+        policy_.clear();
+        recorder_.clear();
+        current_time_ = 0;
+        dispatches_ = 0;
+    }
+
+private:
+    Policy policy_;
+    uint64_t time_slice_;
+    uint64_t current_time_ = 0;
+    size_t dispatches_ = 0;
+    SchedulerRecorder recorder_;
+
+    void record(const Process* process, ProcessState old_state, ProcessState new_state) {
+        if constexpr (SchedulerRecorder::kEnabled) {
+            recorder_.record(ScheduleEvent(current_time_, process->get_pid(), old_state, new_state, 0));
+        }
+    }
+};
+
+/**
+ * @brief Type-erased handle to a PolicyScheduler chosen at run time
+ *
+ * One indirect call per operation; inside that call the policy's code is
+ * fully static. Movable, not copyable.
+ */
+class AnyPolicyScheduler {
+public:
+    /**
+     * @brief Wrap a scheduler for the given policy
+     * @tparam Policy Scheduling policy
+     * @param time_slice Base time slice in milliseconds
+     * @return AnyPolicyScheduler Wrapped scheduler
+     */
+    template<typename Policy>
+    static AnyPolicyScheduler create(uint64_t time_slice = 10) {
+        return AnyPolicyScheduler(std::make_unique<Model<Policy>>(time_slice));
+    }
+
+    const char* get_name() const noexcept { return impl_->get_name(); }
+    bool add_to_ready_queue(Process* process) { return impl_->add_to_ready_queue(process); }
+    Process* get_next_process() { return impl_->get_next_process(); }
+    bool remove_from_ready_queue(Process* process) { return impl_->remove_from_ready_queue(process); }
+    uint64_t get_time_slice(const Process* process) const { return impl_->get_time_slice(process); }
+    void account_runtime(Process* process, uint64_t runtime) { impl_->account_runtime(process, runtime); }
+    void tick(uint64_t current_time) { impl_->tick(current_time); }
+    size_t get_ready_queue_size() const { return impl_->get_ready_queue_size(); }
+    size_t get_dispatch_count() const { return impl_->get_dispatch_count(); }
+    void reset() { impl_->reset(); }
+
+private:
+    struct Concept {
+        virtual ~Concept() = default;
+        virtual const char* get_name() const noexcept = 0;
+        virtual bool add_to_ready_queue(Process* process) = 0;
+        virtual Process* get_next_process() = 0;
+        virtual bool remove_from_ready_queue(Process* process) = 0;
+        virtual uint64_t get_time_slice(const Process* process) const = 0;
+        virtual void account_runtime(Process* process, uint64_t runtime) = 0;
+        virtual void tick(uint64_t current_time) = 0;
+        virtual size_t get_ready_queue_size() const = 0;
+        virtual size_t get_dispatch_count() const = 0;
+        virtual void reset() = 0;
+    };
+
+    template<typename Policy>
+    struct Model final : Concept {
+        explicit Model(uint64_t time_slice) : scheduler(time_slice) {}
+
+        const char* get_name() const noexcept override { return scheduler.get_name(); }
+        bool add_to_ready_queue(Process* process) override { return scheduler.add_to_ready_queue(process); }
+        Process* get_next_process() override { return scheduler.get_next_process(); }
+        bool remove_from_ready_queue(Process* process) override { return scheduler.remove_from_ready_queue(process); }
+        uint64_t get_time_slice(const Process* process) const override { return scheduler.get_time_slice(process); }
+        void account_runtime(Process* process, uint64_t runtime) override { scheduler.account_runtime(process, runtime); }
+        void tick(uint64_t current_time) override { scheduler.tick(current_time); }
+        size_t get_ready_queue_size() const override { return scheduler.get_ready_queue_size(); }
+        size_t get_dispatch_count() const override { return scheduler.get_dispatch_count(); }
+        void reset() override { scheduler.reset(); }
+
+        PolicyScheduler<Policy> scheduler;
+    };
+
+    explicit AnyPolicyScheduler(std::unique_ptr<Concept> impl) : impl_(std::move(impl)) {}
+
+    std::unique_ptr<Concept> impl_;
+};
+
+/**
+ * @brief Create a statically dispatched scheduler for an algorithm
+ *
+ * Available for RR, Priority, SJF, MLFQ, EDF (without admission control)
+ * and Stride.
+ *
+ * @param algorithm Scheduling algorithm
+ * @param time_slice Base time slice in milliseconds
+ * @return AnyPolicyScheduler Wrapped scheduler
+ * @throws std::invalid_argument If the algorithm has no static policy
+ */
+AnyPolicyScheduler make_policy_scheduler(SchedulingAlgorithm algorithm, uint64_t time_slice = 10);
+
+} // namespace osro
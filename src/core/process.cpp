@@ -16,9 +16,24 @@ Process::Process(uint32_t pid,
       remaining_time_(burst_time),
       memory_required_(memory_required),
       priority_(priority),
+      base_priority_(priority),
       state_(ProcessState::NEW),
       name_("Process_" + std::to_string(pid)),
-      completion_time_(0) {
+      completion_time_(0),
+      queue_level_(0),
+      vruntime_(0),
+      relative_deadline_(0),
+      period_(0),
+      pass_(0),
+      core_(kNoCore),
+      last_core_(kNoCore),
+      last_run_time_(0),
+      group_id_(0),
+      cpu_group_id_(0),
+      ready_time_(0),
+      aging_key_(0),
+      burst_estimate_(0),
+      burst_elapsed_(0) {
     
     if (burst_time == 0) {
         throw std::invalid_argument("Burst time must be greater than 0");
@@ -27,6 +42,8 @@ Process::Process(uint32_t pid,
     if (memory_required == 0) {
         throw std::invalid_argument("Memory requirement must be greater than 0");
     }
+    
+    affinity_.set(); // Unpinned by default
 }
 
 uint32_t Process::get_pid() const noexcept {
@@ -53,6 +70,14 @@ ProcessPriority Process::get_priority() const noexcept {
     return priority_;
 }
 
+ProcessPriority Process::get_base_priority() const noexcept {
+    return base_priority_;
+}
+
+void Process::set_priority(ProcessPriority priority) noexcept {
+    priority_ = priority;
+}
+
 ProcessState Process::get_state() const noexcept {
     return state_;
 }
@@ -89,6 +114,18 @@ bool Process::execute(uint64_t time_slice) {
     }
 }
 
+bool Process::start_next_job() noexcept {
+    if (period_ == 0) {
+        return false;
+    }
+    
+    arrival_time_ += period_;
+    remaining_time_ = burst_time_;
+    completion_time_ = 0;
+    state_ = ProcessState::NEW;
+    return true;
+}
+
 uint64_t Process::get_turnaround_time() const noexcept {
     if (completion_time_ == 0) {
         return 0; // Not completed yet
@@ -100,7 +137,9 @@ uint64_t Process::get_waiting_time() const noexcept {
     if (completion_time_ == 0) {
         return 0; // Not completed yet
     }
-    return get_turnaround_time() - burst_time_;
+    // A completion stamped before the last burst ended must not wrap around
+    uint64_t turnaround = get_turnaround_time();
+    return turnaround > burst_time_ ? turnaround - burst_time_ : 0;
 }
 
 uint64_t Process::get_completion_time() const noexcept {
@@ -123,6 +162,203 @@ void Process::add_execution_timestamp(uint64_t timestamp) {
     execution_history_.push_back(timestamp);
 }
 
+QueueHook& Process::get_queue_hook() noexcept {
+    return queue_hook_;
+}
+
+const QueueHook& Process::get_queue_hook() const noexcept {
+    return queue_hook_;
+}
+
+bool Process::is_queued() const noexcept {
+    return queue_hook_.owner != nullptr;
+}
+
+uint32_t Process::get_queue_level() const noexcept {
+    return queue_level_;
+}
+
+void Process::set_queue_level(uint32_t level) noexcept {
+    queue_level_ = level;
+}
+
+uint64_t Process::get_vruntime() const noexcept {
+    return vruntime_;
+}
+
+void Process::set_vruntime(uint64_t vruntime) noexcept {
+    vruntime_ = vruntime;
+}
+
+uint64_t Process::get_relative_deadline() const noexcept {
+    return relative_deadline_;
+}
+
+void Process::set_relative_deadline(uint64_t deadline) noexcept {
+    relative_deadline_ = deadline;
+}
+
+uint64_t Process::get_period() const noexcept {
+    return period_;
+}
+
+void Process::set_period(uint64_t period) noexcept {
+    period_ = period;
+}
+
+bool Process::has_deadline() const noexcept {
+    return relative_deadline_ != 0 || period_ != 0;
+}
+
+uint64_t Process::get_absolute_deadline() const noexcept {
+    if (!has_deadline()) {
+        return UINT64_MAX;
+    }
+    return arrival_time_ + (relative_deadline_ != 0 ? relative_deadline_ : period_);
+}
+
+uint64_t Process::get_pass() const noexcept {
+    return pass_;
+}
+
+void Process::set_pass(uint64_t pass) noexcept {
+    pass_ = pass;
+}
+
+uint32_t Process::get_core() const noexcept {
+    return core_;
+}
+
+void Process::set_core(uint32_t core) noexcept {
+    core_ = core;
+}
+
+const AffinityMask& Process::get_affinity() const noexcept {
+    return affinity_;
+}
+
+void Process::set_affinity(const AffinityMask& affinity) {
+    if (affinity.none()) {
+        throw std::invalid_argument("Affinity mask must allow at least one core");
+    }
+    affinity_ = affinity;
+}
+
+bool Process::can_run_on(size_t core) const noexcept {
+    return core < kMaxCores && affinity_.test(core);
+}
+
+uint32_t Process::get_last_core() const noexcept {
+    return last_core_;
+}
+
+uint64_t Process::get_last_run_time() const noexcept {
+    return last_run_time_;
+}
+
+void Process::set_last_run(uint32_t core, uint64_t timestamp) noexcept {
+    last_core_ = core;
+    last_run_time_ = timestamp;
+}
+
+uint32_t Process::get_group() const noexcept {
+    return group_id_;
+}
+
+void Process::set_group(uint32_t group_id) noexcept {
+    group_id_ = group_id;
+}
+
+uint32_t Process::get_cpu_group() const noexcept {
+    return cpu_group_id_;
+}
+
+void Process::set_cpu_group(uint32_t group_id) noexcept {
+    cpu_group_id_ = group_id;
+}
+
+uint64_t Process::get_ready_time() const noexcept {
+    return ready_time_;
+}
+
+void Process::set_ready_time(uint64_t timestamp) noexcept {
+    ready_time_ = timestamp;
+}
+
+uint64_t Process::get_aging_key() const noexcept {
+    return aging_key_;
+}
+
+void Process::set_aging_key(uint64_t key) noexcept {
+    aging_key_ = key;
+}
+
+uint64_t Process::get_burst_estimate() const noexcept {
+    return burst_estimate_;
+}
+
+void Process::set_burst_estimate(uint64_t estimate) noexcept {
+    burst_estimate_ = estimate;
+}
+
+uint64_t Process::get_burst_elapsed() const noexcept {
+    return burst_elapsed_;
+}
+
+void Process::set_burst_elapsed(uint64_t elapsed) noexcept {
+    burst_elapsed_ = elapsed;
+}
+
+ProcessContext Process::save_context() const {
+    ProcessContext context;
+    context.pid = pid_;
+    context.state = state_;
+    context.priority = priority_;
+    context.arrival_time = arrival_time_;
+    context.remaining_time = remaining_time_;
+    context.completion_time = completion_time_;
+    context.queue_level = queue_level_;
+    context.vruntime = vruntime_;
+    context.pass = pass_;
+    context.core = core_;
+    context.last_core = last_core_;
+    context.last_run_time = last_run_time_;
+    context.ready_time = ready_time_;
+    context.aging_key = aging_key_;
+    context.burst_estimate = burst_estimate_;
+    context.burst_elapsed = burst_elapsed_;
+    context.history_length = execution_history_.size();
+    return context;
+}
+
+void Process::restore_context(const ProcessContext& context) {
+    if (context.pid != pid_) {
+        throw std::invalid_argument("Context belongs to another process");
+    }
+    if (is_queued()) {
+        throw std::runtime_error("Cannot restore the context of a queued process");
+    }
+    
+    state_ = context.state;
+    priority_ = context.priority;
+    arrival_time_ = context.arrival_time;
+    remaining_time_ = context.remaining_time;
+    completion_time_ = context.completion_time;
+    queue_level_ = context.queue_level;
+    vruntime_ = context.vruntime;
+    pass_ = context.pass;
+    core_ = context.core;
+    last_core_ = context.last_core;
+    last_run_time_ = context.last_run_time;
+    ready_time_ = context.ready_time;
+    aging_key_ = context.aging_key;
+    burst_estimate_ = context.burst_estimate;
+    burst_elapsed_ = context.burst_elapsed;
+    if (context.history_length < execution_history_.size()) {
+        execution_history_.resize(context.history_length);
+    }
+}
+
 // Comparison operators for scheduling algorithms
 bool operator<(const Process& lhs, const Process& rhs) {
     // For priority scheduling: higher priority first
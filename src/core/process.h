@@ -1,5 +1,7 @@
 #pragma once
 
+#include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -11,7 +13,7 @@ namespace osro {
 /**
  * @brief Enumeration of process states in the simulation
  */
-enum class ProcessState {
+enum class ProcessState : uint8_t {
     NEW,           // Process created but not yet ready
     READY,         // Process ready to execute
     RUNNING,       // Process currently executing
@@ -29,6 +31,61 @@ enum class ProcessPriority {
     CRITICAL = 15
 };
 
+class Process;
+
+/**
+ * @brief Maximum number of cores an affinity mask can address
+ */
+constexpr size_t kMaxCores = 128;
+
+/**
+ * @brief Set of cores a process may run on; bit i allows core i
+ */
+using AffinityMask = std::bitset<kMaxCores>;
+
+/**
+ * @brief Intrusive hook used by scheduler queues to hold a process
+ * 
+ * Linked queues use the prev/next links, array-backed queues store the
+ * element's slot index. The owner pointer identifies the queue currently
+ * holding the process, so membership checks and unlinking never need to
+ * scan. A process can be held by at most one queue at a time.
+ */
+struct QueueHook {
+    static constexpr size_t npos = SIZE_MAX;
+    
+    Process* prev = nullptr;     // Previous element in a linked queue
+    Process* next = nullptr;     // Next element in a linked queue
+    size_t slot = npos;          // Index in an array-backed queue
+    const void* owner = nullptr; // Queue holding the process, nullptr if none
+};
+
+/**
+ * @brief Scheduling state of a process that changes as it runs
+ * 
+ * Saved with a scheduler snapshot so a simulation can resume from the
+ * same point. Identity and workload parameters are not part of it.
+ */
+struct ProcessContext {
+    uint32_t pid = 0;
+    ProcessState state = ProcessState::NEW;
+    ProcessPriority priority = ProcessPriority::MEDIUM; // Effective priority
+    uint64_t arrival_time = 0;    // Release time of the current job
+    uint64_t remaining_time = 0;
+    uint64_t completion_time = 0;
+    uint32_t queue_level = 0;
+    uint64_t vruntime = 0;
+    uint64_t pass = 0;
+    uint32_t core = 0;
+    uint32_t last_core = 0;
+    uint64_t last_run_time = 0;
+    uint64_t ready_time = 0;
+    uint64_t aging_key = 0;
+    uint64_t burst_estimate = 0;
+    uint64_t burst_elapsed = 0;
+    size_t history_length = 0;    // Execution timestamps recorded so far
+};
+
 /**
  * @brief Represents a simulated process in the operating system
  * 
@@ -39,6 +96,8 @@ enum class ProcessPriority {
  */
 class Process {
 public:
+    static constexpr uint32_t kNoCore = UINT32_MAX;
+
     /**
      * @brief Construct a new Process object
      * 
@@ -86,10 +145,29 @@ public:
 
     /**
      * @brief Get process priority
+     * 
+     * This is the effective priority every policy schedules by; it is
+     * above the base priority while a lock protocol boosts the process.
+     * 
      * @return ProcessPriority Priority level
      */
     ProcessPriority get_priority() const noexcept;
 
+    /**
+     * @brief Get the priority the process was created with
+     * @return ProcessPriority Base priority level
+     */
+    ProcessPriority get_base_priority() const noexcept;
+
+    /**
+     * @brief Set effective priority, leaving the base priority unchanged
+     * 
+     * Does not re-key a queued process; use Scheduler::set_effective_priority.
+     * 
+     * @param priority New effective priority
+     */
+    void set_priority(ProcessPriority priority) noexcept;
+
     /**
      * @brief Get current process state
      * @return ProcessState Current state
@@ -121,6 +199,17 @@ public:
      */
     bool execute(uint64_t time_slice);
 
+    /**
+     * @brief Release the next job of a periodic task
+     * 
+     * The arrival time advances by one period and the burst is refilled,
+     * so turnaround and absolute deadline refer to the new job. The
+     * process returns to NEW until the release time is reached.
+     * 
+     * @return true if a job was released, false for aperiodic processes
+     */
+    bool start_next_job() noexcept;
+
     /**
      * @brief Get turnaround time (completion - arrival)
      * @return uint64_t Turnaround time
@@ -129,7 +218,7 @@ public:
 
     /**
      * @brief Get waiting time (time spent in ready queue)
-     * @return uint64_t Waiting time
+     * @return uint64_t Turnaround minus burst time, never below 0
      */
     uint64_t get_waiting_time() const noexcept;
 
@@ -163,6 +252,238 @@ public:
      */
     void add_execution_timestamp(uint64_t timestamp);
 
+    /**
+     * @brief Get the intrusive hook used by scheduler queues
+     * @return QueueHook& Queue hook
+     */
+    QueueHook& get_queue_hook() noexcept;
+
+    /**
+     * @brief Get the intrusive hook used by scheduler queues
+     * @return const QueueHook& Queue hook
+     */
+    const QueueHook& get_queue_hook() const noexcept;
+
+    /**
+     * @brief Check if process is currently held by a scheduler queue
+     * @return true if queued, false otherwise
+     */
+    bool is_queued() const noexcept;
+
+    /**
+     * @brief Get multilevel feedback queue level
+     * @return uint32_t Queue level (0 is the highest priority)
+     */
+    uint32_t get_queue_level() const noexcept;
+
+    /**
+     * @brief Set multilevel feedback queue level
+     * @param level Queue level (0 is the highest priority)
+     */
+    void set_queue_level(uint32_t level) noexcept;
+
+    /**
+     * @brief Get weighted virtual runtime for fair scheduling
+     * @return uint64_t Virtual runtime in microseconds
+     */
+    uint64_t get_vruntime() const noexcept;
+
+    /**
+     * @brief Set weighted virtual runtime for fair scheduling
+     * @param vruntime Virtual runtime in microseconds
+     */
+    void set_vruntime(uint64_t vruntime) noexcept;
+
+    /**
+     * @brief Get relative deadline
+     * @return uint64_t Deadline relative to arrival, 0 if none
+     */
+    uint64_t get_relative_deadline() const noexcept;
+
+    /**
+     * @brief Set relative deadline
+     * @param deadline Deadline relative to arrival, 0 for none
+     */
+    void set_relative_deadline(uint64_t deadline) noexcept;
+
+    /**
+     * @brief Get activation period of a periodic task
+     * @return uint64_t Period, 0 if aperiodic
+     */
+    uint64_t get_period() const noexcept;
+
+    /**
+     * @brief Set activation period of a periodic task
+     * @param period Period, 0 for aperiodic
+     */
+    void set_period(uint64_t period) noexcept;
+
+    /**
+     * @brief Check if process has real-time timing constraints
+     * @return true if a deadline or period is set
+     */
+    bool has_deadline() const noexcept;
+
+    /**
+     * @brief Get absolute deadline of the current job
+     * 
+     * The relative deadline defaults to the period when only a period is set.
+     * 
+     * @return uint64_t Absolute deadline, UINT64_MAX if none
+     */
+    uint64_t get_absolute_deadline() const noexcept;
+
+    /**
+     * @brief Get stride scheduling pass value
+     * @return uint64_t Pass value
+     */
+    uint64_t get_pass() const noexcept;
+
+    /**
+     * @brief Set stride scheduling pass value
+     * @param pass Pass value
+     */
+    void set_pass(uint64_t pass) noexcept;
+
+    /**
+     * @brief Get core whose run queue holds the process or that last ran it
+     * @return uint32_t Core index, kNoCore if never placed
+     */
+    uint32_t get_core() const noexcept;
+
+    /**
+     * @brief Set core the process is placed on
+     * @param core Core index
+     */
+    void set_core(uint32_t core) noexcept;
+
+    /**
+     * @brief Get cores the process may run on
+     * @return const AffinityMask& Affinity mask (all cores by default)
+     */
+    const AffinityMask& get_affinity() const noexcept;
+
+    /**
+     * @brief Restrict the cores the process may run on
+     * @param affinity Affinity mask (must allow at least one core)
+     */
+    void set_affinity(const AffinityMask& affinity);
+
+    /**
+     * @brief Check whether the affinity mask allows a core
+     * @param core Core index
+     * @return bool True if the process may run on the core
+     */
+    bool can_run_on(size_t core) const noexcept;
+
+    /**
+     * @brief Get core the process last ran on
+     * @return uint32_t Core index, kNoCore if it never ran
+     */
+    uint32_t get_last_core() const noexcept;
+
+    /**
+     * @brief Get time the process last stopped running
+     * @return uint64_t Timestamp in milliseconds
+     */
+    uint64_t get_last_run_time() const noexcept;
+
+    /**
+     * @brief Record where and until when the process last ran
+     * @param core Core it ran on
+     * @param timestamp Time it stopped running
+     */
+    void set_last_run(uint32_t core, uint64_t timestamp) noexcept;
+
+    /**
+     * @brief Get process group the process belongs to
+     * @return uint32_t Group ID, 0 if not grouped
+     */
+    uint32_t get_group() const noexcept;
+
+    /**
+     * @brief Set process group (maintained by ProcessManager)
+     * @param group_id Group ID, 0 for none
+     */
+    void set_group(uint32_t group_id) noexcept;
+
+    /**
+     * @brief Get CPU controller group the process is charged to
+     * @return uint32_t CPU group ID, 0 for the root group
+     */
+    uint32_t get_cpu_group() const noexcept;
+
+    /**
+     * @brief Set CPU controller group (maintained by CpuController)
+     * @param group_id CPU group ID, 0 for the root group
+     */
+    void set_cpu_group(uint32_t group_id) noexcept;
+
+    /**
+     * @brief Get time the process last entered a ready queue
+     * @return uint64_t Timestamp in milliseconds
+     */
+    uint64_t get_ready_time() const noexcept;
+
+    /**
+     * @brief Set time the process entered a ready queue
+     * @param timestamp Timestamp in milliseconds
+     */
+    void set_ready_time(uint64_t timestamp) noexcept;
+
+    /**
+     * @brief Get aged priority key (lower runs first, 0 when aging is off)
+     * @return uint64_t Aging key
+     */
+    uint64_t get_aging_key() const noexcept;
+
+    /**
+     * @brief Set aged priority key
+     * @param key Aging key
+     */
+    void set_aging_key(uint64_t key) noexcept;
+
+    /**
+     * @brief Get predicted length of the next CPU burst (0 = no history)
+     * @return uint64_t Exponentially weighted burst average in milliseconds
+     */
+    uint64_t get_burst_estimate() const noexcept;
+
+    /**
+     * @brief Set predicted CPU burst length
+     * @param estimate Burst estimate in milliseconds
+     */
+    void set_burst_estimate(uint64_t estimate) noexcept;
+
+    /**
+     * @brief Get CPU time consumed in the current burst
+     * @return uint64_t Milliseconds run since the process last became runnable
+     */
+    uint64_t get_burst_elapsed() const noexcept;
+
+    /**
+     * @brief Set CPU time consumed in the current burst
+     * @param elapsed Milliseconds run in the current burst
+     */
+    void set_burst_elapsed(uint64_t elapsed) noexcept;
+
+    /**
+     * @brief Capture the scheduling state of the process
+     * @return ProcessContext Current context
+     */
+    ProcessContext save_context() const;
+
+    /**
+     * @brief Return the process to a saved context
+     * 
+     * Execution timestamps recorded after the save are dropped.
+     * 
+     * @param context Context saved from this process
+     * @throws std::invalid_argument If the context belongs to another process
+     * @throws std::runtime_error If the process is queued
+     */
+    void restore_context(const ProcessContext& context);
+
 private:
     uint32_t pid_;
     uint64_t arrival_time_;
@@ -170,10 +491,27 @@ private:
     uint64_t remaining_time_;
     uint64_t memory_required_;
     ProcessPriority priority_;
+    ProcessPriority base_priority_;
     ProcessState state_;
     std::string name_;
     uint64_t completion_time_;
     std::vector<uint64_t> execution_history_;
+    QueueHook queue_hook_;
+    uint32_t queue_level_;
+    uint64_t vruntime_;
+    uint64_t relative_deadline_;
+    uint64_t period_;
+    uint64_t pass_;
+    uint32_t core_;
+    uint32_t last_core_;
+    uint64_t last_run_time_;
+    uint32_t group_id_;
+    uint32_t cpu_group_id_;
+    uint64_t ready_time_;
+    uint64_t aging_key_;
+    uint64_t burst_estimate_;
+    uint64_t burst_elapsed_;
+    AffinityMask affinity_;
 };
 
 /**
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "process.h"
+#include <cstddef>
+
+namespace osro {
+
+/**
+ * @brief Intrusive FIFO list of processes
+ *
+ * Links processes through their QueueHook, so enqueue, dequeue and
+ * removal of an arbitrary member are all O(1) and never allocate.
+ */
+class ProcessList {
+public:
+    ProcessList() = default;
+    ProcessList(const ProcessList&) = delete;
+    ProcessList& operator=(const ProcessList&) = delete;
+
+    /**
+     * @brief Append a process at the tail
+     * @param process Process to append (must not be queued elsewhere)
+     */
+    void push_back(Process* process) noexcept {
+        QueueHook& hook = process->get_queue_hook();
+        hook.prev = tail_;
+        hook.next = nullptr;
+        hook.owner = this;
+        if (tail_) {
+            tail_->get_queue_hook().next = process;
+        } else {
+            head_ = process;
+        }
+        tail_ = process;
+        ++size_;
+    }
+
+    /**
+     * @brief Insert a process at the head
+     * @param process Process to insert (must not be queued elsewhere)
+     */
+    void push_front(Process* process) noexcept {
+        QueueHook& hook = process->get_queue_hook();
+        hook.prev = nullptr;
+        hook.next = head_;
+        hook.owner = this;
+        if (head_) {
+            head_->get_queue_hook().prev = process;
+        } else {
+            tail_ = process;
+        }
+        head_ = process;
+        ++size_;
+    }
+
+    /**
+     * @brief Get the process at the head
+     * @return Process* Head process, nullptr if empty
+     */
+    Process* front() const noexcept {
+        return head_;
+    }
+
+    /**
+     * @brief Remove and return the process at the head
+     * @return Process* Removed process, nullptr if empty
+     */
+    Process* pop_front() noexcept {
+        Process* process = head_;
+        if (process) {
+            unlink(process);
+        }
+        return process;
+    }
+
+    /**
+     * @brief Unlink a process from anywhere in the list
+     * @param process Process to remove
+     * @return bool True if the process was in this list
+     */
+    bool erase(Process* process) noexcept {
+        if (!contains(process)) {
+            return false;
+        }
+        unlink(process);
+        return true;
+    }
+
+    /**
+     * @brief Check whether a process is in this list
+     * @param process Process to look up
+     * @return bool True if linked into this list
+     */
+    bool contains(const Process* process) const noexcept {
+        return process->get_queue_hook().owner == this;
+    }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Unlink every process
+     */
+    void clear() noexcept {
+        while (head_) {
+            unlink(head_);
+        }
+    }
+
+    /**
+     * @brief Visit every process in FIFO order
+     * @param visit Callable taking Process*
+     */
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const {
+        for (Process* process = head_; process; process = process->get_queue_hook().next) {
+            visit(process);
+        }
+    }
+
+    /**
+     * @brief Get the process following a member in FIFO order
+     * @param process Member of this list
+     * @return Process* Next process, nullptr at the tail
+     */
+    static Process* next(const Process* process) noexcept {
+        return process->get_queue_hook().next;
+    }
+
+private:
+    Process* head_ = nullptr;
+    Process* tail_ = nullptr;
+    size_t size_ = 0;
+
+    void unlink(Process* process) noexcept {
+        QueueHook& hook = process->get_queue_hook();
+        if (hook.prev) {
+            hook.prev->get_queue_hook().next = hook.next;
+        } else {
+            head_ = hook.next;
+        }
+        if (hook.next) {
+            hook.next->get_queue_hook().prev = hook.prev;
+        } else {
+            tail_ = hook.prev;
+        }
+        hook.prev = hook.next = nullptr;
+        hook.owner = nullptr;
+        --size_;
+    }
+};
+
+} // namespace osro
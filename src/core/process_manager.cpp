@@ -4,7 +4,7 @@
 
 namespace osro {
 
-ProcessManager::ProcessManager() : next_pid_(1) {}
+ProcessManager::ProcessManager() : next_pid_(1), next_group_id_(1) {}
 
 Process* ProcessManager::create_process(uint64_t arrival_time,
                                        uint64_t burst_time,
@@ -40,6 +40,7 @@ bool ProcessManager::destroy_process(uint32_t pid) {
     }
     
     Process* process = it->second;
+    leave_group(process);
     
     // Remove from map
     process_map_.erase(it);
@@ -96,6 +97,7 @@ size_t ProcessManager::cleanup_terminated() {
     while (it != processes_.end()) {
         if ((*it)->get_state() == ProcessState::TERMINATED) {
             uint32_t pid = (*it)->get_pid();
+            leave_group(it->get());
             process_map_.erase(pid);
             it = processes_.erase(it);
             cleaned++;
@@ -107,10 +109,62 @@ size_t ProcessManager::cleanup_terminated() {
     return cleaned;
 }
 
+uint32_t ProcessManager::create_group() {
+    uint32_t group_id = next_group_id_++;
+    groups_[group_id];
+    return group_id;
+}
+
+bool ProcessManager::add_to_group(uint32_t group_id, uint32_t pid) {
+    auto group = groups_.find(group_id);
+    Process* process = get_process(pid);
+    if (group == groups_.end() || !process) {
+        return false;
+    }
+    if (process->get_group() == group_id) {
+        return true;
+    }
+    
+    leave_group(process);
+    group->second.push_back(process);
+    process->set_group(group_id);
+    return true;
+}
+
+bool ProcessManager::remove_from_group(uint32_t pid) {
+    Process* process = get_process(pid);
+    if (!process || process->get_group() == 0) {
+        return false;
+    }
+    leave_group(process);
+    return true;
+}
+
+const std::vector<Process*>& ProcessManager::get_group_members(uint32_t group_id) const {
+    static const std::vector<Process*> empty;
+    auto group = groups_.find(group_id);
+    return (group != groups_.end()) ? group->second : empty;
+}
+
+size_t ProcessManager::get_group_count() const noexcept {
+    return groups_.size();
+}
+
 void ProcessManager::reset() {
     processes_.clear();
     process_map_.clear();
+    groups_.clear();
     next_pid_ = 1;
+    next_group_id_ = 1;
+}
+
+void ProcessManager::leave_group(Process* process) {
+    auto group = groups_.find(process->get_group());
+    if (group != groups_.end()) {
+        auto& members = group->second;
+        members.erase(std::remove(members.begin(), members.end(), process), members.end());
+    }
+    process->set_group(0);
 }
 
 } // namespace osro
\ No newline at end of file
@@ -15,7 +15,8 @@ namespace osro {
  * This class implements the process control block (PCB) management
  * functionality, handling process creation, state transitions,
  * and process termination. It serves as the central authority
- * for process management in the simulation.
+ * for process management in the simulation. Processes can be
+ * collected into groups that a gang scheduler runs together.
  */
 class ProcessManager {
 public:
@@ -76,6 +77,40 @@ public:
      */
     size_t get_completed_count() const noexcept;
 
+    /**
+     * @brief Create an empty process group
+     * @return uint32_t New group ID (never 0)
+     */
+    uint32_t create_group();
+
+    /**
+     * @brief Add a process to a group, leaving any previous group
+     * @param group_id Target group
+     * @param pid Process identifier
+     * @return bool False if the group or process does not exist
+     */
+    bool add_to_group(uint32_t group_id, uint32_t pid);
+
+    /**
+     * @brief Remove a process from its group
+     * @param pid Process identifier
+     * @return bool True if the process was grouped
+     */
+    bool remove_from_group(uint32_t pid);
+
+    /**
+     * @brief Get members of a group
+     * @param group_id Group identifier
+     * @return const std::vector<Process*>& Members, empty if the group does not exist
+     */
+    const std::vector<Process*>& get_group_members(uint32_t group_id) const;
+
+    /**
+     * @brief Get number of process groups
+     * @return size_t Group count
+     */
+    size_t get_group_count() const noexcept;
+
     /**
      * @brief Clean up all terminated processes
      * @return size_t Number of processes cleaned up
@@ -91,6 +126,14 @@ private:
     std::vector<std::unique_ptr<Process>> processes_;
     std::unordered_map<uint32_t, Process*> process_map_;
     uint32_t next_pid_;
+    std::unordered_map<uint32_t, std::vector<Process*>> groups_;
+    uint32_t next_group_id_;
+    
+    /**
+     * @brief Drop a process from its group's member list
+     * @param process Process leaving its group
+     */
+    void leave_group(Process* process);
 };
 
 } // namespace osro
\ No newline at end of file
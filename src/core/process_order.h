@@ -0,0 +1,101 @@
+#pragma once
+
+#include "process.h"
+#include "slo_queue.h"
+#include <cstdint>
+
+namespace osro {
+
+/**
+ * @brief Get the key ordering a process under priority aging
+ *
+ * A waiting process gains one priority level per interval. Keying it
+ * once by ready_time + (levels below CRITICAL) * interval makes comparing
+ * keys the same as comparing aged priorities at any later time.
+ *
+ * @param ready_time Time the process became ready
+ * @param priority Process priority
+ * @param interval Wait per priority level in milliseconds (0 = strict priority)
+ * @return uint64_t Aging key, lower runs first
+ */
+inline uint64_t get_aging_key(uint64_t ready_time, ProcessPriority priority, uint64_t interval) noexcept {
+    if (interval == 0) {
+        return 0;
+    }
+    // Count levels, not enum values, which are spaced unevenly
+    uint64_t levels_behind = SloQueue::get_class(ProcessPriority::CRITICAL) - SloQueue::get_class(priority);
+    return ready_time + levels_behind * interval;
+}
+
+/**
+ * @brief Order for priority scheduling: lowest aging key, then higher priority
+ */
+struct PriorityOrder {
+    bool operator()(const Process* a, const Process* b) const noexcept {
+        if (a->get_aging_key() != b->get_aging_key()) {
+            return a->get_aging_key() < b->get_aging_key(); // Highest aged priority first
+        }
+        return *a < *b; // Higher priority first
+    }
+};
+
+/**
+ * @brief Order for SJF and SRTF: shortest remaining time, then arrival
+ */
+struct RemainingTimeOrder {
+    bool operator()(const Process* a, const Process* b) const noexcept {
+        if (a->get_remaining_time() != b->get_remaining_time()) {
+            return a->get_remaining_time() < b->get_remaining_time(); // Shorter job first
+        }
+        return a->get_arrival_time() < b->get_arrival_time();
+    }
+};
+
+/**
+ * @brief Order for EDF: earliest absolute deadline, then arrival
+ */
+struct DeadlineOrder {
+    bool operator()(const Process* a, const Process* b) const noexcept {
+        if (a->get_absolute_deadline() != b->get_absolute_deadline()) {
+            return a->get_absolute_deadline() < b->get_absolute_deadline(); // Earliest deadline first
+        }
+        return a->get_arrival_time() < b->get_arrival_time();
+    }
+};
+
+/**
+ * @brief Get the rate-monotonic rank of a process
+ * @param process Process to rank
+ * @return uint64_t Period, UINT64_MAX for aperiodic processes so they rank below every periodic task
+ */
+inline uint64_t rate_monotonic_period(const Process* process) noexcept {
+    return process->get_period() != 0 ? process->get_period() : UINT64_MAX;
+}
+
+/**
+ * @brief Order for rate-monotonic scheduling: shortest period, then PID
+ */
+struct RateMonotonicOrder {
+    bool operator()(const Process* a, const Process* b) const noexcept {
+        uint64_t period_a = rate_monotonic_period(a);
+        uint64_t period_b = rate_monotonic_period(b);
+        if (period_a != period_b) {
+            return period_a < period_b; // Shortest period first
+        }
+        return a->get_pid() < b->get_pid();
+    }
+};
+
+/**
+ * @brief Order for stride scheduling: lowest pass, then PID
+ */
+struct PassOrder {
+    bool operator()(const Process* a, const Process* b) const noexcept {
+        if (a->get_pass() != b->get_pass()) {
+            return a->get_pass() < b->get_pass(); // Lowest pass first
+        }
+        return a->get_pid() < b->get_pid();
+    }
+};
+
+} // namespace osro
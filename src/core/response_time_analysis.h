@@ -0,0 +1,132 @@
+#pragma once
+
+#include "process.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Periodic task parameters for schedulability analysis
+ */
+struct PeriodicTask {
+    uint32_t id = 0;        // Caller's identifier (the PID for processes)
+    uint64_t wcet = 0;      // Worst-case execution time per job in ms
+    uint64_t period = 0;    // Release period in ms
+    uint64_t deadline = 0;  // Relative deadline in ms, 0 = period
+};
+
+/**
+ * @brief Analysis result of one task
+ */
+struct TaskResponse {
+    uint32_t id = 0;
+    uint64_t deadline = 0;       // Effective relative deadline in ms
+    uint64_t response_time = 0;  // Worst-case response time in ms (lower bound if unschedulable)
+    bool schedulable = false;    // Response time within the deadline
+    uint64_t observed = 0;       // Longest response seen in simulation, 0 if none
+};
+
+/**
+ * @brief Exact response-time analysis of a rate-monotonic task set
+ *
+ * Runs the classic fixed-point iteration
+ *     R = C_i + sum over higher-priority j of ceil(R / T_j) * C_j
+ * for every task on one preemptive core, with priorities assigned by
+ * period. Each task starts from R_{i-1} + C_i, a valid lower bound that
+ * typically converges in a few steps. Higher-priority tasks release
+ * ceil(R / T_j) jobs, a count that only changes at period boundaries, so
+ * tasks with long periods relative to R are charged per job count from a
+ * prefix table of WCETs. Only the shortest-period tasks go through the
+ * ceiling loop, which is branch-free and lane-parallel so the compiler
+ * vectorizes it across tasks. Ceilings are computed in double precision and corrected
+ * with exact products, so results are exact for times below kMaxTime.
+ *
+ * Deadlines must not exceed periods; synchronous release is assumed, so
+ * the bound is the critical-instant response time.
+ */
+class ResponseTimeAnalysis {
+public:
+    /// Largest WCET, period or deadline accepted, keeping arithmetic exact
+    static constexpr uint64_t kMaxTime = uint64_t{1} << 40;
+
+    /**
+     * @brief Analyze a task set
+     * @param tasks Tasks in any order
+     * @throws std::invalid_argument On a zero WCET or period, a deadline
+     *         beyond the period, or a time above kMaxTime
+     */
+    explicit ResponseTimeAnalysis(std::vector<PeriodicTask> tasks);
+
+    /**
+     * @brief Collect the periodic processes of a workload as tasks
+     *
+     * Deadlines beyond the period are clamped to the period, which keeps
+     * the verdict safe.
+     *
+     * @param processes Processes to scan; aperiodic ones are skipped
+     * @return std::vector<PeriodicTask> One task per periodic process
+     */
+    static std::vector<PeriodicTask> collect(const std::vector<Process*>& processes);
+
+    /**
+     * @brief Check whether every task meets its deadline
+     * @return bool True if the task set is schedulable
+     */
+    bool is_schedulable() const noexcept { return schedulable_; }
+
+    /**
+     * @brief Get total utilization sum(C / T)
+     * @return double Utilization
+     */
+    double get_utilization() const noexcept { return utilization_; }
+
+    /**
+     * @brief Get the Liu and Layland utilization bound n(2^(1/n) - 1)
+     * @return double Sufficient (not necessary) bound for this task count
+     */
+    double get_utilization_bound() const noexcept;
+
+    /**
+     * @brief Get total fixed-point iterations performed
+     * @return size_t Iterations over all tasks
+     */
+    size_t get_iterations() const noexcept { return iterations_; }
+
+    /**
+     * @brief Get per-task results in rate-monotonic priority order
+     * @return const std::vector<TaskResponse>& Task results
+     */
+    const std::vector<TaskResponse>& get_tasks() const noexcept { return results_; }
+
+    /**
+     * @brief Look up a task's result
+     * @param id Task identifier
+     * @return const TaskResponse* Result, nullptr if the task is unknown
+     */
+    const TaskResponse* find(uint32_t id) const;
+
+    /**
+     * @brief Record a response time observed in simulation
+     * @param id Task identifier (unknown IDs are ignored)
+     * @param response_time Release-to-completion time of one job in ms
+     */
+    void observe(uint32_t id, uint64_t response_time);
+
+    /**
+     * @brief Count tasks whose observed response exceeded the prediction
+     * @return size_t Tasks where simulation and analysis disagree
+     */
+    size_t get_violation_count() const noexcept;
+
+private:
+    std::vector<TaskResponse> results_;
+    std::unordered_map<uint32_t, size_t> index_;
+    double utilization_;
+    size_t iterations_;
+    bool schedulable_;
+};
+
+} // namespace osro
@@ -0,0 +1,361 @@
+#include "run_queue.h"
+#include "scheduler.h"
+#include <algorithm>
+
+namespace osro {
+
+RunQueue::RunQueue(SchedulingAlgorithm algorithm, uint32_t seed)
+    : algorithm_(algorithm),
+      stride_global_pass_(0),
+      lottery_queue_(seed) {
+}
+
+void RunQueue::set_algorithm(SchedulingAlgorithm algorithm) {
+    if (algorithm_ == algorithm) {
+        return;
+    }
+    
+    std::vector<Process*> queued = release();
+    algorithm_ = algorithm;
+    assign(std::move(queued));
+}
+
+void RunQueue::push(Process* process) {
+    switch (algorithm_) {
+        case SchedulingAlgorithm::ROUND_ROBIN:
+            ready_queue_.push_back(process);
+            break;
+        case SchedulingAlgorithm::PRIORITY:
+            priority_queue_.push(process);
+            break;
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+        case SchedulingAlgorithm::SRTF:
+            sjf_queue_.push(process);
+            break;
+        case SchedulingAlgorithm::MLFQ:
+            mlfq_queue_.push(process);
+            break;
+        case SchedulingAlgorithm::FAIR:
+            fair_queue_.push(process);
+            break;
+        case SchedulingAlgorithm::EDF:
+            edf_queue_.push(process);
+            break;
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            rm_queue_.push(process);
+            break;
+        case SchedulingAlgorithm::LOTTERY:
+            lottery_queue_.push(process);
+            break;
+        case SchedulingAlgorithm::STRIDE:
+            // Joining processes start at the global pass instead of jumping ahead
+            process->set_pass(std::max(process->get_pass(), stride_global_pass_));
+            stride_queue_.push(process);
+            break;
+        case SchedulingAlgorithm::SLO:
+            slo_queue_.push(process);
+            break;
+    }
+}
+
+void RunQueue::push_batch(Process* const* processes, size_t count) {
+    switch (algorithm_) {
+        case SchedulingAlgorithm::PRIORITY:
+            priority_queue_.push_range(processes, count);
+            break;
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+        case SchedulingAlgorithm::SRTF:
+            sjf_queue_.push_range(processes, count);
+            break;
+        case SchedulingAlgorithm::EDF:
+            edf_queue_.push_range(processes, count);
+            break;
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            rm_queue_.push_range(processes, count);
+            break;
+        case SchedulingAlgorithm::STRIDE:
+            for (size_t i = 0; i < count; ++i) {
+                processes[i]->set_pass(std::max(processes[i]->get_pass(), stride_global_pass_));
+            }
+            stride_queue_.push_range(processes, count);
+            break;
+        default:
+            // List-based queues already insert in O(1)
+            for (size_t i = 0; i < count; ++i) {
+                push(processes[i]);
+            }
+            break;
+    }
+}
+
+Process* RunQueue::pop(uint64_t now) {
+    switch (algorithm_) {
+        case SchedulingAlgorithm::ROUND_ROBIN:
+            return ready_queue_.pop_front();
+        case SchedulingAlgorithm::PRIORITY:
+            return priority_queue_.pop();
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+        case SchedulingAlgorithm::SRTF:
+            return sjf_queue_.pop();
+        case SchedulingAlgorithm::MLFQ:
+            return mlfq_queue_.pop();
+        case SchedulingAlgorithm::FAIR:
+            return fair_queue_.pop();
+        case SchedulingAlgorithm::EDF:
+            return edf_queue_.pop();
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            return rm_queue_.pop();
+        case SchedulingAlgorithm::LOTTERY:
+            return lottery_queue_.pop();
+        case SchedulingAlgorithm::STRIDE: {
+            Process* process = stride_queue_.pop();
+            if (process) {
+                stride_global_pass_ = std::max(stride_global_pass_, process->get_pass());
+            }
+            return process;
+        }
+        case SchedulingAlgorithm::SLO:
+            return slo_queue_.pop(now);
+    }
+    return nullptr;
+}
+
+const Process* RunQueue::peek() const {
+    switch (algorithm_) {
+        case SchedulingAlgorithm::ROUND_ROBIN:
+            return ready_queue_.front();
+        case SchedulingAlgorithm::PRIORITY:
+            return priority_queue_.top();
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+        case SchedulingAlgorithm::SRTF:
+            return sjf_queue_.top();
+        case SchedulingAlgorithm::FAIR:
+            return fair_queue_.top();
+        case SchedulingAlgorithm::EDF:
+            return edf_queue_.top();
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            return rm_queue_.top();
+        case SchedulingAlgorithm::STRIDE:
+            return stride_queue_.top();
+        case SchedulingAlgorithm::MLFQ:
+        case SchedulingAlgorithm::LOTTERY:
+        case SchedulingAlgorithm::SLO:
+            return nullptr;
+    }
+    return nullptr;
+}
+
+bool RunQueue::erase(Process* process) {
+    // The queue hook identifies the holding structure, so no scan is needed
+    return ready_queue_.erase(process) ||
+           priority_queue_.erase(process) ||
+           sjf_queue_.erase(process) ||
+           mlfq_queue_.erase(process) ||
+           fair_queue_.erase(process) ||
+           edf_queue_.erase(process) ||
+           rm_queue_.erase(process) ||
+           lottery_queue_.erase(process) ||
+           stride_queue_.erase(process) ||
+           slo_queue_.erase(process);
+}
+
+bool RunQueue::update(Process* process) {
+    switch (algorithm_) {
+        case SchedulingAlgorithm::PRIORITY:
+            return priority_queue_.update(process);
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+        case SchedulingAlgorithm::SRTF:
+            return sjf_queue_.update(process);
+        case SchedulingAlgorithm::EDF:
+            return edf_queue_.update(process);
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            return rm_queue_.update(process);
+        case SchedulingAlgorithm::LOTTERY:
+            return lottery_queue_.update(process);
+        case SchedulingAlgorithm::STRIDE:
+            return stride_queue_.update(process);
+        case SchedulingAlgorithm::SLO:
+            // Classes follow the effective priority
+            return slo_queue_.update(process);
+        case SchedulingAlgorithm::FAIR:
+            // Re-seat the node, recharging its weight at the new priority
+            if (fair_queue_.erase(process)) {
+                fair_queue_.push(process);
+                return true;
+            }
+            return false;
+        case SchedulingAlgorithm::ROUND_ROBIN:
+        case SchedulingAlgorithm::MLFQ:
+            break;
+    }
+    
+    // FIFO levels do not depend on any key
+    return false;
+}
+
+bool RunQueue::contains(const Process* process) const noexcept {
+    return ready_queue_.contains(process) ||
+           priority_queue_.contains(process) ||
+           sjf_queue_.contains(process) ||
+           mlfq_queue_.contains(process) ||
+           fair_queue_.contains(process) ||
+           edf_queue_.contains(process) ||
+           rm_queue_.contains(process) ||
+           lottery_queue_.contains(process) ||
+           stride_queue_.contains(process) ||
+           slo_queue_.contains(process);
+}
+
+std::vector<Process*> RunQueue::release() {
+    std::vector<Process*> queued;
+    
+    switch (algorithm_) {
+        case SchedulingAlgorithm::ROUND_ROBIN:
+            queued.reserve(ready_queue_.size());
+            while (Process* process = ready_queue_.pop_front()) {
+                queued.push_back(process);
+            }
+            break;
+        case SchedulingAlgorithm::PRIORITY:
+            queued = priority_queue_.release();
+            break;
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+        case SchedulingAlgorithm::SRTF:
+            queued = sjf_queue_.release();
+            break;
+        case SchedulingAlgorithm::MLFQ:
+            queued = mlfq_queue_.release();
+            break;
+        case SchedulingAlgorithm::FAIR:
+            queued = fair_queue_.release();
+            break;
+        case SchedulingAlgorithm::EDF:
+            queued = edf_queue_.release();
+            break;
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            queued = rm_queue_.release();
+            break;
+        case SchedulingAlgorithm::LOTTERY:
+            queued = lottery_queue_.release();
+            break;
+        case SchedulingAlgorithm::STRIDE:
+            queued = stride_queue_.release();
+            break;
+        case SchedulingAlgorithm::SLO:
+            queued = slo_queue_.release();
+            break;
+    }
+    
+    return queued;
+}
+
+void RunQueue::assign(std::vector<Process*> processes) {
+    // Heapify in O(n) rather than re-inserting one by one
+    switch (algorithm_) {
+        case SchedulingAlgorithm::PRIORITY:
+            priority_queue_.assign(std::move(processes));
+            break;
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+        case SchedulingAlgorithm::SRTF:
+            sjf_queue_.assign(std::move(processes));
+            break;
+        case SchedulingAlgorithm::EDF:
+            edf_queue_.assign(std::move(processes));
+            break;
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            rm_queue_.assign(std::move(processes));
+            break;
+        case SchedulingAlgorithm::STRIDE:
+            for (Process* process : processes) {
+                process->set_pass(std::max(process->get_pass(), stride_global_pass_));
+            }
+            stride_queue_.assign(std::move(processes));
+            break;
+        case SchedulingAlgorithm::FAIR:
+            // Migrated processes must not carry a stale lead into this queue
+            for (Process* process : processes) {
+                process->set_vruntime(std::max(process->get_vruntime(),
+                                               fair_queue_.get_min_vruntime()));
+                fair_queue_.push(process);
+            }
+            break;
+        case SchedulingAlgorithm::ROUND_ROBIN:
+        case SchedulingAlgorithm::MLFQ:
+        case SchedulingAlgorithm::LOTTERY:
+        case SchedulingAlgorithm::SLO:
+            for (Process* process : processes) {
+                push(process);
+            }
+            break;
+    }
+}
+
+void RunQueue::boost() {
+    if (algorithm_ == SchedulingAlgorithm::MLFQ) {
+        mlfq_queue_.boost();
+    }
+}
+
+void RunQueue::set_mlfq_levels(size_t levels) {
+    std::vector<Process*> queued;
+    if (algorithm_ == SchedulingAlgorithm::MLFQ) {
+        queued = mlfq_queue_.release();
+    }
+    
+    mlfq_queue_.set_level_count(levels);
+    
+    for (Process* process : queued) {
+        mlfq_queue_.push(process);
+    }
+}
+
+size_t RunQueue::size() const noexcept {
+    switch (algorithm_) {
+        case SchedulingAlgorithm::PRIORITY:
+            return priority_queue_.size();
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+        case SchedulingAlgorithm::SRTF:
+            return sjf_queue_.size();
+        case SchedulingAlgorithm::MLFQ:
+            return mlfq_queue_.size();
+        case SchedulingAlgorithm::FAIR:
+            return fair_queue_.size();
+        case SchedulingAlgorithm::EDF:
+            return edf_queue_.size();
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            return rm_queue_.size();
+        case SchedulingAlgorithm::LOTTERY:
+            return lottery_queue_.size();
+        case SchedulingAlgorithm::STRIDE:
+            return stride_queue_.size();
+        case SchedulingAlgorithm::SLO:
+            return slo_queue_.size();
+        case SchedulingAlgorithm::ROUND_ROBIN:
+            break;
+    }
+    return ready_queue_.size();
+}
+
+void RunQueue::reset() noexcept {
+    fair_queue_.reset();
+    stride_global_pass_ = 0;
+}
+
+RunQueueClocks RunQueue::get_clocks() const {
+    RunQueueClocks clocks;
+    clocks.stride_pass = stride_global_pass_;
+    clocks.min_vruntime = fair_queue_.get_min_vruntime();
+    clocks.lottery_generator = lottery_queue_.get_generator();
+    clocks.lottery_slots = lottery_queue_.get_slot_count();
+    clocks.lottery_free_slots = lottery_queue_.get_free_slots();
+    return clocks;
+}
+
+void RunQueue::set_clocks(const RunQueueClocks& clocks) {
+    stride_global_pass_ = clocks.stride_pass;
+    fair_queue_.reset(clocks.min_vruntime);
+    lottery_queue_.set_generator(clocks.lottery_generator);
+    lottery_queue_.set_layout(clocks.lottery_slots, clocks.lottery_free_slots);
+}
+
+} // namespace osro
@@ -0,0 +1,242 @@
+#pragma once
+
+#include "process.h"
+#include "fair_queue.h"
+#include "indexed_heap.h"
+#include "lottery_queue.h"
+#include "multilevel_queue.h"
+#include "process_list.h"
+#include "process_order.h"
+#include "slo_queue.h"
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Enumeration of scheduling algorithms
+ */
+enum class SchedulingAlgorithm {
+    ROUND_ROBIN,      // Time-slice based scheduling
+    PRIORITY,         // Priority-based scheduling
+    SHORTEST_JOB_FIRST, // SJF scheduling (non-preemptive: runs each burst to completion)
+    SRTF,             // Shortest remaining time first, preempted by shorter arrivals
+    MLFQ,             // Multilevel feedback queue scheduling
+    FAIR,             // Weighted virtual-runtime fair scheduling (CFS style)
+    EDF,              // Earliest deadline first with admission control
+    RATE_MONOTONIC,   // Preemptive fixed priority, shorter period first
+    LOTTERY,          // Proportional share by random ticket draw
+    STRIDE,           // Proportional share by deterministic pass values
+    SLO               // Per-priority FIFOs served by tail-latency SLO urgency
+};
+
+/**
+ * @brief Policy clocks of one core, enough to resume its passes and draws
+ */
+struct RunQueueClocks {
+    uint64_t stride_pass = 0;           // Global stride pass
+    uint64_t min_vruntime = 0;          // Fair queue minimum virtual runtime
+    std::mt19937_64 lottery_generator;  // Lottery draw state
+    size_t lottery_slots = 0;           // Lottery slot table length, free slots included
+    std::vector<size_t> lottery_free_slots; // Free lottery slots in reuse order
+};
+
+/**
+ * @brief Ready structures of a single simulated core
+ * 
+ * Owns one ready structure per scheduling algorithm and routes every
+ * operation to the structure of the active algorithm. Only the active
+ * structure holds processes; changing the algorithm migrates them in
+ * O(n), heapifying where the target is a heap.
+ */
+class RunQueue {
+public:
+    /**
+     * @brief Construct a new Run Queue
+     * @param algorithm Initial scheduling algorithm
+     * @param seed Seed for lottery draws on this core
+     */
+    RunQueue(SchedulingAlgorithm algorithm, uint32_t seed);
+    RunQueue(const RunQueue&) = delete;
+    RunQueue& operator=(const RunQueue&) = delete;
+
+    /**
+     * @brief Switch algorithm, migrating queued processes
+     * @param algorithm New algorithm
+     */
+    void set_algorithm(SchedulingAlgorithm algorithm);
+
+    /**
+     * @brief Insert a process into the active structure
+     * 
+     * Stride processes are placed no earlier than the core's global pass;
+     * fair placement is left to the caller.
+     * 
+     * @param process Process to insert
+     */
+    void push(Process* process);
+
+    /**
+     * @brief Queue several processes, heapifying once for large batches
+     * @param processes First process
+     * @param count Number of processes
+     */
+    void push_batch(Process* const* processes, size_t count);
+
+    /**
+     * @brief Remove the process the active algorithm would run next
+     * @param now Current time, which SLO class selection depends on
+     * @return Process* Removed process, nullptr if empty
+     */
+    Process* pop(uint64_t now);
+
+    /**
+     * @brief Get the process pop() would return without removing it
+     * 
+     * MLFQ, lottery and SLO picks are not predicted and return nullptr.
+     * 
+     * @return const Process* Next process, nullptr if empty or unpredictable
+     */
+    const Process* peek() const;
+
+    /**
+     * @brief Remove a queued process
+     * @param process Process to remove
+     * @return bool True if the process was queued on this core
+     */
+    bool erase(Process* process);
+
+    /**
+     * @brief Restore order after a queued process changed its key
+     * @param process Process whose key changed
+     * @return bool True if the process was queued and its key matters
+     */
+    bool update(Process* process);
+
+    /**
+     * @brief Check whether a process is queued on this core
+     * @param process Process to look up
+     * @return bool True if queued here
+     */
+    bool contains(const Process* process) const noexcept;
+
+    /**
+     * @brief Visit every queued process in unspecified order
+     * @param visit Callable taking Process*
+     */
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const {
+        switch (algorithm_) {
+            case SchedulingAlgorithm::ROUND_ROBIN:
+                ready_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::PRIORITY:
+                priority_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+            case SchedulingAlgorithm::SRTF:
+                sjf_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::MLFQ:
+                mlfq_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::FAIR:
+                fair_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::EDF:
+                edf_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::RATE_MONOTONIC:
+                rm_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::LOTTERY:
+                lottery_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::STRIDE:
+                stride_queue_.for_each(visit);
+                break;
+            case SchedulingAlgorithm::SLO:
+                slo_queue_.for_each(visit);
+                break;
+        }
+    }
+
+    /**
+     * @brief Remove every queued process
+     * @return std::vector<Process*> Previously queued processes
+     */
+    std::vector<Process*> release();
+
+    /**
+     * @brief Insert many processes, heapifying in O(n) where possible
+     * @param processes Processes to insert
+     */
+    void assign(std::vector<Process*> processes);
+
+    /**
+     * @brief Move every queued MLFQ process to the top level
+     */
+    void boost();
+
+    /**
+     * @brief Change the MLFQ level count, re-queueing MLFQ processes
+     * @param levels Number of levels
+     */
+    void set_mlfq_levels(size_t levels);
+
+    /**
+     * @brief Set the urgency scale of an SLO class
+     * @param cls Class index (see SloQueue::get_class)
+     * @param scale Urgency per ms of head wait
+     */
+    void set_slo_scale(size_t cls, double scale) { slo_queue_.set_scale(cls, scale); }
+
+    const MultilevelQueue& get_mlfq_queue() const noexcept { return mlfq_queue_; }
+    const SloQueue& get_slo_queue() const noexcept { return slo_queue_; }
+    const FairQueue& get_fair_queue() const noexcept { return fair_queue_; }
+    uint64_t get_stride_pass() const noexcept { return stride_global_pass_; }
+    SchedulingAlgorithm get_algorithm() const noexcept { return algorithm_; }
+
+    size_t size() const noexcept;
+    bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * @brief Reset policy clocks (queue must be empty)
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Capture the policy clocks of this core
+     * @return RunQueueClocks Current clocks
+     */
+    RunQueueClocks get_clocks() const;
+
+    /**
+     * @brief Continue from saved policy clocks (queue must be empty)
+     * 
+     * Also lays out the lottery slots as captured, so assigning the
+     * captured processes in for_each() order resumes the same draws.
+     * 
+     * @param clocks Clocks captured by get_clocks()
+     */
+    void set_clocks(const RunQueueClocks& clocks);
+
+private:
+    SchedulingAlgorithm algorithm_;
+    uint64_t stride_global_pass_;
+
+    ProcessList ready_queue_;
+    IndexedHeap<PriorityOrder> priority_queue_;
+    IndexedHeap<RemainingTimeOrder> sjf_queue_;
+    MultilevelQueue mlfq_queue_;
+    FairQueue fair_queue_;
+    IndexedHeap<DeadlineOrder> edf_queue_;
+    IndexedHeap<RateMonotonicOrder> rm_queue_;
+    LotteryQueue lottery_queue_;
+    IndexedHeap<PassOrder> stride_queue_;
+    SloQueue slo_queue_;
+};
+
+} // namespace osro
@@ -0,0 +1,140 @@
+#include "schedule_history.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace osro {
+
+ScheduleHistory::ScheduleHistory(size_t capacity)
+    : head_(0),
+      size_(0),
+      total_recorded_(0),
+      chunk_events_(kDefaultChunkEvents) {
+    
+    if (capacity == 0) {
+        throw std::invalid_argument("History capacity must be greater than 0");
+    }
+    buffer_.resize(capacity);
+}
+
+ScheduleHistory::~ScheduleHistory() {
+    try {
+        disable_spill();
+    } catch (...) {
+        // Destructors must not throw; a failed final write is lost
+    }
+}
+
+void ScheduleHistory::record(const ScheduleEvent& event) {
+    buffer_[head_] = event;
+    head_ = (head_ + 1 == buffer_.size()) ? 0 : head_ + 1;
+    size_ = std::min(size_ + 1, buffer_.size());
+    total_recorded_++;
+    
+    if (spill_.is_open()) {
+        spill_chunk_.push_back(event);
+        if (spill_chunk_.size() >= chunk_events_) {
+            flush();
+        }
+    }
+}
+
+void ScheduleHistory::record(const ScheduleEvent* events, size_t count) {
+    if (spill_.is_open()) {
+        for (size_t i = 0; i < count; ) {
+            size_t take = std::min(count - i, chunk_events_ - spill_chunk_.size());
+            spill_chunk_.insert(spill_chunk_.end(), events + i, events + i + take);
+            i += take;
+            if (spill_chunk_.size() >= chunk_events_) {
+                flush();
+            }
+        }
+    }
+    total_recorded_ += count;
+    
+    // Only the newest capacity() events can survive
+    const size_t capacity = buffer_.size();
+    if (count > capacity) {
+        events += count - capacity;
+        count = capacity;
+    }
+    size_t first = std::min(count, capacity - head_);
+    std::copy(events, events + first, buffer_.begin() + head_);
+    std::copy(events + first, events + count, buffer_.begin());
+    head_ = (head_ + count) % capacity;
+    size_ = std::min(size_ + count, capacity);
+}
+
+const ScheduleEvent& ScheduleHistory::operator[](size_t index) const {
+    if (index >= size_) {
+        throw std::out_of_range("History index out of range");
+    }
+    size_t oldest = (head_ + buffer_.size() - size_) % buffer_.size();
+    return buffer_[(oldest + index) % buffer_.size()];
+}
+
+std::vector<ScheduleEvent> ScheduleHistory::get_events() const {
+    std::vector<ScheduleEvent> events;
+    events.reserve(size_);
+    for (size_t i = 0; i < size_; ++i) {
+        events.push_back((*this)[i]);
+    }
+    return events;
+}
+
+void ScheduleHistory::set_capacity(size_t capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("History capacity must be greater than 0");
+    }
+    
+    std::vector<ScheduleEvent> events = get_events();
+    size_t keep = std::min(events.size(), capacity);
+    
+    buffer_.assign(capacity, ScheduleEvent());
+    std::copy(events.end() - keep, events.end(), buffer_.begin());
+    size_ = keep;
+    head_ = keep % capacity;
+}
+
+void ScheduleHistory::enable_spill(const std::string& path, size_t chunk_events) {
+    if (chunk_events == 0) {
+        throw std::invalid_argument("Spill chunk size must be greater than 0");
+    }
+    
+    disable_spill();
+    spill_.open(path, std::ios::binary | std::ios::trunc);
+    if (!spill_.is_open()) {
+        throw std::runtime_error("Cannot open history spill file: " + path);
+    }
+    chunk_events_ = chunk_events;
+    spill_chunk_.reserve(chunk_events);
+}
+
+void ScheduleHistory::disable_spill() {
+    if (!spill_.is_open()) {
+        return;
+    }
+    flush();
+    spill_.close();
+    spill_chunk_.clear();
+    spill_chunk_.shrink_to_fit();
+}
+
+void ScheduleHistory::flush() {
+    if (!spill_.is_open() || spill_chunk_.empty()) {
+        return;
+    }
+    
+    spill_.write(reinterpret_cast<const char*>(spill_chunk_.data()),
+                 static_cast<std::streamsize>(spill_chunk_.size() * sizeof(ScheduleEvent)));
+    spill_chunk_.clear();
+    if (!spill_) {
+        throw std::runtime_error("Failed to write history spill file");
+    }
+}
+
+void ScheduleHistory::clear() noexcept {
+    head_ = 0;
+    size_ = 0;
+}
+
+} // namespace osro
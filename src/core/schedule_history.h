@@ -0,0 +1,134 @@
+#pragma once
+
+#include "process.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Represents a scheduling event
+ * 
+ * Packed into 16 bytes and keyed by PID rather than by pointer, so events
+ * stay meaningful after the process is destroyed and can be written to
+ * disk verbatim.
+ */
+struct ScheduleEvent {
+    static constexpr uint16_t kNoCore = UINT16_MAX;
+    
+    uint64_t timestamp;
+    uint32_t pid;
+    ProcessState old_state;
+    ProcessState new_state;
+    uint16_t core;
+    
+    ScheduleEvent() = default;
+    ScheduleEvent(uint64_t time, uint32_t process_id, ProcessState old_s, ProcessState new_s,
+                  uint16_t core_index = kNoCore)
+        : timestamp(time), pid(process_id), old_state(old_s), new_state(new_s), core(core_index) {}
+};
+
+static_assert(sizeof(ScheduleEvent) == 16, "ScheduleEvent must stay 16 bytes");
+
+/**
+ * @brief Fixed-capacity ring buffer of scheduling events
+ * 
+ * Keeps the most recent events in constant memory; once full, each new
+ * event overwrites the oldest. Optionally every event is also streamed
+ * to a file in chunks of raw 16-byte records, so a complete history can
+ * be kept on disk while memory stays bounded.
+ */
+class ScheduleHistory {
+public:
+    static constexpr size_t kDefaultCapacity = 65536;   // 1 MiB of events
+    static constexpr size_t kDefaultChunkEvents = 4096; // 64 KiB per write
+
+    /**
+     * @brief Construct a new Schedule History
+     * @param capacity Number of events kept in memory
+     */
+    explicit ScheduleHistory(size_t capacity = kDefaultCapacity);
+    ~ScheduleHistory();
+    ScheduleHistory(const ScheduleHistory&) = delete;
+    ScheduleHistory& operator=(const ScheduleHistory&) = delete;
+
+    /**
+     * @brief Append an event, overwriting the oldest when full
+     * @param event Event to record
+     */
+    void record(const ScheduleEvent& event);
+
+    /**
+     * @brief Append a batch of events with at most two block copies
+     * @param events First event
+     * @param count Number of events
+     */
+    void record(const ScheduleEvent* events, size_t count);
+
+    /**
+     * @brief Access a retained event
+     * @param index 0 for the oldest retained event
+     * @return const ScheduleEvent& Event
+     */
+    const ScheduleEvent& operator[](size_t index) const;
+
+    /**
+     * @brief Copy the retained events, oldest first
+     * @return std::vector<ScheduleEvent> Retained events
+     */
+    std::vector<ScheduleEvent> get_events() const;
+
+    /**
+     * @brief Change the in-memory capacity, keeping the newest events
+     * @param capacity Number of events kept in memory
+     */
+    void set_capacity(size_t capacity);
+
+    /**
+     * @brief Stream every subsequent event to a binary file
+     * @param path Output file (truncated)
+     * @param chunk_events Events buffered per write
+     */
+    void enable_spill(const std::string& path, size_t chunk_events = kDefaultChunkEvents);
+
+    /**
+     * @brief Flush buffered events and stop streaming to disk
+     */
+    void disable_spill();
+
+    /**
+     * @brief Write buffered events to the spill file
+     */
+    void flush();
+
+    bool is_spilling() const noexcept { return spill_.is_open(); }
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_t capacity() const noexcept { return buffer_.size(); }
+
+    /**
+     * @brief Get number of events ever recorded
+     * @return uint64_t Recorded events, including overwritten ones
+     */
+    uint64_t get_total_recorded() const noexcept { return total_recorded_; }
+
+    /**
+     * @brief Drop retained events (events already spilled stay on disk)
+     */
+    void clear() noexcept;
+
+private:
+    std::vector<ScheduleEvent> buffer_;
+    size_t head_;   // Slot the next event is written to
+    size_t size_;
+    uint64_t total_recorded_;
+    
+    std::ofstream spill_;
+    std::vector<ScheduleEvent> spill_chunk_;
+    size_t chunk_events_;
+};
+
+} // namespace osro
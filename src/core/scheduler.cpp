@@ -1,25 +1,124 @@
 #include "scheduler.h"
+#include "scheduler_snapshot.h"
 #include <algorithm>
+#include <cmath>
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <queue>
 
 namespace osro {
 
+namespace {
+
+// Seed of core 0's lottery generator; core n uses kLotterySeed + n
+constexpr uint32_t kLotterySeed = 42;
+
+// Slice granted when nobody else waits and the quantum is not adaptive
+constexpr uint64_t kUncontendedTimeSlice = 50;
+
+// Bursts observed before the adaptive quantum replaces the fixed slice
+constexpr size_t kAdaptiveWarmup = 5;
+
+// Candidates examined per migration, bounding the cost of a steal
+constexpr size_t kMigrationScanLimit = 32;
+
+// Bounds of an SLO class's urgency weight, and the waits seen before it moves
+constexpr double kMinSloWeight = 0.25;
+constexpr double kMaxSloWeight = 4.0;
+constexpr size_t kSloWarmup = 5;
+
+// Index of a priority level in per-priority statistics
+size_t priority_index(ProcessPriority priority) noexcept {
+    return SloQueue::get_class(priority);
+}
+
+// Packed event for the history; cores beyond 16 bits are not representable
+ScheduleEvent make_event(const Process* process, ProcessState old_state,
+                         ProcessState new_state, uint64_t timestamp, uint32_t core) noexcept {
+    uint16_t core_index = core < ScheduleEvent::kNoCore ? static_cast<uint16_t>(core)
+                                                        : ScheduleEvent::kNoCore;
+    return ScheduleEvent(timestamp, process->get_pid(), old_state, new_state, core_index);
+}
+
+} // namespace
+
+const char* to_string(SchedulingAlgorithm algorithm) noexcept {
+    switch (algorithm) {
+        case SchedulingAlgorithm::ROUND_ROBIN:
+            return "RR";
+        case SchedulingAlgorithm::PRIORITY:
+            return "Priority";
+        case SchedulingAlgorithm::SHORTEST_JOB_FIRST:
+            return "SJF";
+        case SchedulingAlgorithm::SRTF:
+            return "SRTF";
+        case SchedulingAlgorithm::MLFQ:
+            return "MLFQ";
+        case SchedulingAlgorithm::FAIR:
+            return "Fair";
+        case SchedulingAlgorithm::EDF:
+            return "EDF";
+        case SchedulingAlgorithm::RATE_MONOTONIC:
+            return "RM";
+        case SchedulingAlgorithm::LOTTERY:
+            return "Lottery";
+        case SchedulingAlgorithm::STRIDE:
+            return "Stride";
+        case SchedulingAlgorithm::SLO:
+            return "SLO";
+    }
+    return "Unknown";
+}
+
 Scheduler::Scheduler(SchedulingAlgorithm algorithm, uint64_t time_slice)
     : algorithm_(algorithm),
       time_slice_(time_slice),
-      context_switches_(0) {
+      context_switches_(0),
+      current_time_(0),
+      mlfq_boost_interval_(MultilevelQueue::kDefaultBoostInterval),
+      last_boost_time_(0),
+      target_latency_(0),
+      min_granularity_(0),
+      edf_utilization_(0.0),
+      edf_utilization_bound_(1.0),
+      deadline_misses_(0),
+      admission_rejections_(0),
+      priority_aging_interval_(0),
+      adaptive_target_(0.0),
+      adaptive_min_quantum_(0),
+      adaptive_max_quantum_(0),
+      load_balance_interval_(100),
+      last_balance_time_(0),
+      migrations_(0),
+      preemptions_(0),
+      preemption_overhead_(0),
+      cache_model_{1, 4, 100},
+      gang_source_(nullptr),
+      gang_ready_count_(0),
+      cpu_controller_(nullptr),
+      lock_protocol_(LockProtocol::NONE),
+      lock_manager_(*this) {
     
     if (time_slice == 0) {
         throw std::invalid_argument("Time slice must be greater than 0");
     }
+    
+    run_queues_.push_back(std::make_unique<RunQueue>(algorithm_, kLotterySeed));
+    core_stats_.resize(1);
+    slice_runtime_.resize(1, 0);
 }
 
 void Scheduler::set_algorithm(SchedulingAlgorithm algorithm) {
-    if (algorithm_ != algorithm) {
-        algorithm_ = algorithm;
-        convert_to_priority_queue();
+    bool was_grouped = is_group_scheduling();
+    algorithm_ = algorithm;
+    for (auto& queue : run_queues_) {
+        queue->set_algorithm(algorithm);
+    }
+    
+    // Entering or leaving FAIR moves processes between the hierarchy and the cores
+    if (was_grouped != is_group_scheduling()) {
+        requeue(was_grouped ? cpu_controller_->release() : std::vector<Process*>{});
     }
 }
 
@@ -30,85 +129,700 @@ void Scheduler::set_time_slice(uint64_t time_slice) {
     time_slice_ = time_slice;
 }
 
-void Scheduler::add_to_ready_queue(Process* process) {
+void Scheduler::set_mlfq_parameters(size_t levels, uint64_t boost_interval) {
+    for (auto& queue : run_queues_) {
+        queue->set_mlfq_levels(levels);
+    }
+    mlfq_boost_interval_ = boost_interval;
+}
+
+void Scheduler::set_fair_parameters(uint64_t target_latency, uint64_t min_granularity) {
+    if (target_latency != 0 && min_granularity != 0 && min_granularity > target_latency) {
+        throw std::invalid_argument("Minimum granularity cannot exceed target latency");
+    }
+    target_latency_ = target_latency;
+    min_granularity_ = min_granularity;
+}
+
+void Scheduler::set_priority_aging(uint64_t interval) {
+    priority_aging_interval_ = interval;
+}
+
+void Scheduler::set_latency_slo(ProcessPriority priority, uint64_t target, double quantile) {
+    if (!(quantile > 0.0 && quantile < 1.0)) {
+        throw std::invalid_argument("SLO quantile must be between 0 and 1");
+    }
+    
+    size_t cls = priority_index(priority);
+    slo_stats_[cls] = SloStats{};
+    if (target != 0) {
+        slo_stats_[cls].target = target;
+        slo_stats_[cls].quantile = quantile;
+        slo_sketches_[cls].reset(quantile);
+    }
+    apply_slo_scale(cls);
+}
+
+void Scheduler::set_adaptive_quantum(double target_fraction, uint64_t min_quantum,
+                                     uint64_t max_quantum) {
+    if (!(target_fraction >= 0.0 && target_fraction < 1.0)) {
+        throw std::invalid_argument("Target fraction must be in [0, 1)");
+    }
+    if (min_quantum == 0 || min_quantum > max_quantum) {
+        throw std::invalid_argument("Quantum bounds must satisfy 0 < min <= max");
+    }
+    
+    adaptive_target_ = target_fraction;
+    adaptive_min_quantum_ = min_quantum;
+    adaptive_max_quantum_ = max_quantum;
+    if (target_fraction > 0.0) {
+        burst_sketch_.reset(target_fraction);
+    }
+}
+
+bool Scheduler::is_adaptive_quantum() const noexcept {
+    return adaptive_target_ > 0.0;
+}
+
+uint64_t Scheduler::get_adaptive_quantum() const {
+    if (!is_adaptive_quantum() || burst_sketch_.get_count() < kAdaptiveWarmup) {
+        return time_slice_;
+    }
+    uint64_t quantile = static_cast<uint64_t>(std::ceil(burst_sketch_.get()));
+    return std::clamp(quantile, adaptive_min_quantum_, adaptive_max_quantum_);
+}
+
+void Scheduler::set_edf_utilization_bound(double bound) {
+    if (!(bound > 0.0)) {
+        throw std::invalid_argument("Utilization bound must be greater than 0");
+    }
+    edf_utilization_bound_ = bound;
+}
+
+void Scheduler::set_core_count(size_t cores) {
+    if (cores == 0) {
+        throw std::invalid_argument("Core count must be greater than 0");
+    }
+    if (cores == run_queues_.size()) {
+        return;
+    }
+    
+    // Drain the cores that go away before shrinking
+    std::vector<Process*> displaced;
+    for (size_t core = cores; core < run_queues_.size(); ++core) {
+        std::vector<Process*> queued = run_queues_[core]->release();
+        displaced.insert(displaced.end(), queued.begin(), queued.end());
+    }
+    
+    run_queues_.resize(cores);
+    core_stats_.resize(cores);
+    slice_runtime_.resize(cores, 0);
+    for (size_t core = 0; core < cores; ++core) {
+        if (!run_queues_[core]) {
+            run_queues_[core] = std::make_unique<RunQueue>(
+                algorithm_, kLotterySeed + static_cast<uint32_t>(core));
+            run_queues_[core]->set_mlfq_levels(run_queues_[0]->get_mlfq_queue().get_level_count());
+            for (size_t cls = 0; cls < SloQueue::kClasses; ++cls) {
+                run_queues_[core]->set_slo_scale(cls, run_queues_[0]->get_slo_queue().get_scale(cls));
+            }
+        }
+    }
+    
+    for (Process* process : displaced) {
+        enqueue(process, select_core(process));
+    }
+    balance_load();
+}
+
+size_t Scheduler::get_core_count() const noexcept {
+    return run_queues_.size();
+}
+
+void Scheduler::set_load_balance_interval(uint64_t interval) {
+    load_balance_interval_ = interval;
+}
+
+void Scheduler::set_cache_model(const CacheModel& model) {
+    cache_model_ = model;
+}
+
+const CacheModel& Scheduler::get_cache_model() const noexcept {
+    return cache_model_;
+}
+
+void Scheduler::set_gang_scheduling(const ProcessManager* process_manager) {
+    gang_source_ = process_manager;
+    if (gang_source_) {
+        return;
+    }
+    
+    // Hand held gang members back to the per-core queues
+    for (uint32_t group_id : gang_order_) {
+        GangQueue& gang = gangs_[group_id];
+        while (Process* process = gang.ready.pop_front()) {
+            enqueue(process, select_core(process));
+        }
+        gang.listed = false;
+    }
+    gang_order_.clear();
+    gang_ready_count_ = 0;
+}
+
+bool Scheduler::is_gang_scheduling() const noexcept {
+    return gang_source_ != nullptr;
+}
+
+std::vector<Process*> Scheduler::schedule_gangs() {
+    std::vector<Process*> slots(run_queues_.size(), nullptr);
+    if (!gang_source_) {
+        return slots;
+    }
+    gang_stats_.quanta++;
+    
+    size_t free_cores = slots.size();
+    bool deferred = false;
+    std::deque<uint32_t> waiting;
+    
+    for (uint32_t group_id : gang_order_) {
+        GangQueue& gang = gangs_[group_id];
+        const auto& members = gang_source_->get_group_members(group_id);
+        
+        if (gang.ready.empty() || members.size() > slots.size()) {
+            // Gangs that outgrew the core count fall back to independent scheduling
+            while (Process* process = gang.ready.pop_front()) {
+                gang_ready_count_--;
+                enqueue(process, select_core(process));
+            }
+            gang.listed = false;
+            continue;
+        }
+        
+        // Running a gang while a member is blocked or running would split it
+        size_t live = 0;
+        for (const Process* member : members) {
+            if (member->get_state() != ProcessState::TERMINATED) {
+                live++;
+            }
+        }
+        if (gang.ready.size() < live) {
+            gang_stats_.incomplete++;
+            waiting.push_back(group_id);
+            continue;
+        }
+        
+        if (gang.ready.size() > free_cores || !place_gang(gang, slots)) {
+            gang_stats_.deferrals++;
+            deferred = true;
+            waiting.push_back(group_id);
+            continue;
+        }
+        
+        free_cores -= gang.ready.size();
+        for (size_t core = 0; core < slots.size(); ++core) {
+            Process* member = slots[core];
+            if (member && gang.ready.erase(member)) {
+                gang_ready_count_--;
+                dispatch(member, core);
+            }
+        }
+        gang.listed = false;
+        gang_stats_.dispatches++;
+    }
+    
+    gang_order_.swap(waiting);
+    if (deferred) {
+        gang_stats_.fragmented_slots += free_cores;
+    }
+    return slots;
+}
+
+const GangStats& Scheduler::get_gang_stats() const noexcept {
+    return gang_stats_;
+}
+
+void Scheduler::set_cpu_controller(CpuController* controller) {
+    std::vector<Process*> displaced;
+    if (cpu_controller_) {
+        displaced = cpu_controller_->release();
+    }
+    cpu_controller_ = controller;
+    requeue(std::move(displaced));
+}
+
+const CpuController* Scheduler::get_cpu_controller() const noexcept {
+    return cpu_controller_;
+}
+
+bool Scheduler::is_group_scheduling() const noexcept {
+    return cpu_controller_ && algorithm_ == SchedulingAlgorithm::FAIR;
+}
+
+void Scheduler::set_lock_protocol(LockProtocol protocol) {
+    lock_protocol_ = protocol;
+}
+
+LockProtocol Scheduler::get_lock_protocol() const noexcept {
+    return lock_protocol_;
+}
+
+LockManager& Scheduler::get_lock_manager() noexcept {
+    return lock_manager_;
+}
+
+const LockManager& Scheduler::get_lock_manager() const noexcept {
+    return lock_manager_;
+}
+
+void Scheduler::set_effective_priority(Process* process, ProcessPriority priority) {
+    if (!process || process->get_priority() == priority) {
+        return;
+    }
+    
+    process->set_priority(priority);
+    if (process->get_state() == ProcessState::READY) {
+        process->set_aging_key(aging_key(process));
+        update_ready_process(process);
+    }
+}
+
+uint64_t Scheduler::get_time_slice(const Process* process) const {
+    if (!process) {
+        return time_slice_;
+    }
+    
+    switch (algorithm_) {
+        case SchedulingAlgorithm::MLFQ:
+            return MultilevelQueue::get_time_slice(time_slice_, process->get_queue_level());
+        case SchedulingAlgorithm::FAIR: {
+            // Share of the period proportional to weight among runnable processes
+            uint32_t core = process->get_core();
+            const FairQueue& fair_queue = is_group_scheduling() ?
+                cpu_controller_->get_queue(process) :
+                run_queues_[core < run_queues_.size() ? core : 0]->get_fair_queue();
+            uint64_t weight = FairQueue::get_weight(process->get_priority());
+            bool queued = fair_queue.contains(process);
+            uint64_t runnable = fair_queue.size() + (queued ? 0 : 1);
+            uint64_t total_weight = fair_queue.get_total_weight() + (queued ? 0 : weight);
+            uint64_t granularity = get_min_granularity();
+            uint64_t period = std::max(get_target_latency(), runnable * granularity);
+            uint64_t slice = std::max(granularity, period * weight / total_weight);
+            if (is_group_scheduling()) {
+                // Stop at the point where a group runs out of quota
+                slice = std::min(slice, std::max<uint64_t>(1, cpu_controller_->get_quota_remaining(process)));
+            }
+            return slice;
+        }
+        case SchedulingAlgorithm::ROUND_ROBIN: {
+            if (!is_adaptive_quantum()) {
+                return time_slice_;
+            }
+            // Let a burst that is predicted to end shortly finish now
+            uint64_t quantum = get_adaptive_quantum();
+            uint64_t estimate = process->get_burst_estimate();
+            uint64_t elapsed = process->get_burst_elapsed();
+            uint64_t predicted = estimate > elapsed ? estimate - elapsed : 0;
+            if (predicted > quantum && predicted <= quantum + quantum / 2) {
+                return predicted;
+            }
+            return quantum;
+        }
+        default:
+            return time_slice_;
+    }
+}
+
+uint64_t Scheduler::get_uncontended_time_slice() const noexcept {
+    return is_adaptive_quantum() ? adaptive_max_quantum_ : kUncontendedTimeSlice;
+}
+
+void Scheduler::account_runtime(Process* process, uint64_t runtime) {
     if (!process) {
         return;
     }
     
-    process->set_state(ProcessState::READY);
-    record_event(process, ProcessState::NEW, ProcessState::READY, 0);
+    uint32_t core = process->get_core();
+    if (core < core_stats_.size()) {
+        core_stats_[core].busy_time += runtime;
+        slice_runtime_[core] += runtime;
+        process->set_last_run(core, current_time_ + runtime);
+    }
+    
+    process->set_burst_elapsed(process->get_burst_elapsed() + runtime);
+    
+    if (process->get_remaining_time() == 0) {
+        end_burst(process);
+        if (process->has_deadline() &&
+            current_time_ + runtime > process->get_absolute_deadline()) {
+            deadline_misses_++;
+        }
+        release_admission(process);
+    }
+    
+    switch (algorithm_) {
+        case SchedulingAlgorithm::MLFQ: {
+            // Demote CPU-bound processes that used their whole quantum, which
+            // may have been charged over several calls since the dispatch
+            uint32_t level = process->get_queue_level();
+            uint64_t used = core < slice_runtime_.size() ? slice_runtime_[core] : runtime;
+            if (used >= get_time_slice(process) && level + 1 < run_queues_[0]->get_mlfq_queue().get_level_count()) {
+                process->set_queue_level(level + 1);
+                if (core < slice_runtime_.size()) {
+                    slice_runtime_[core] = 0;
+                }
+            }
+            break;
+        }
+        case SchedulingAlgorithm::FAIR:
+            process->set_vruntime(process->get_vruntime() +
+                                  FairQueue::to_vruntime(runtime, process->get_priority()));
+            break;
+        case SchedulingAlgorithm::STRIDE:
+            process->set_pass(process->get_pass() + LotteryQueue::get_stride(process->get_priority()) * runtime);
+            break;
+        default:
+            break;
+    }
     
-    ready_queue_.push(process);
+    if (is_group_scheduling()) {
+        cpu_controller_->charge(process, runtime, current_time_ + runtime);
+    }
 }
 
-Process* Scheduler::get_next_process() {
-    if (ready_queue_.empty()) {
-        return nullptr;
+bool Scheduler::is_preemptive() const noexcept {
+    return algorithm_ == SchedulingAlgorithm::SRTF ||
+           algorithm_ == SchedulingAlgorithm::RATE_MONOTONIC;
+}
+
+bool Scheduler::holds_core() const noexcept {
+    return is_preemptive() || algorithm_ == SchedulingAlgorithm::SHORTEST_JOB_FIRST;
+}
+
+bool Scheduler::should_preempt(const Process* running, size_t core) const {
+    if (core >= run_queues_.size()) {
+        throw std::out_of_range("Core index out of range");
+    }
+    if (!running || !is_preemptive()) {
+        return false;
+    }
+    
+    const Process* next = run_queues_[core]->peek();
+    if (!next) {
+        return false;
+    }
+    if (algorithm_ == SchedulingAlgorithm::RATE_MONOTONIC) {
+        return rate_monotonic_period(next) < rate_monotonic_period(running);
+    }
+    return next->get_remaining_time() < running->get_remaining_time();
+}
+
+void Scheduler::preempt(Process* process, size_t core, uint64_t overhead) {
+    if (!process) {
+        return;
+    }
+    if (core >= run_queues_.size()) {
+        throw std::out_of_range("Core index out of range");
     }
     
-    Process* process = ready_queue_.front();
-    ready_queue_.pop();
+    preemptions_++;
+    preemption_overhead_ += overhead;
+    core_stats_[core].preemptions++;
+    core_stats_[core].switch_overhead += overhead;
     
-    process->set_state(ProcessState::RUNNING);
-    record_event(process, ProcessState::READY, ProcessState::RUNNING, 0);
+    // Stay on the core whose cache still holds the working set
+    make_ready(process);
+    enqueue(process, core);
+    record_event(process, ProcessState::RUNNING, ProcessState::READY, current_time_);
+}
+
+size_t Scheduler::get_preemption_count() const noexcept {
+    return preemptions_;
+}
+
+uint64_t Scheduler::get_preemption_overhead() const noexcept {
+    return preemption_overhead_;
+}
+
+void Scheduler::block_process(Process* process) {
+    if (!process) {
+        return;
+    }
     
-    return process;
+    end_burst(process);
+    ProcessState previous = process->get_state();
+    process->set_state(ProcessState::BLOCKED);
+    record_event(process, previous, ProcessState::BLOCKED, current_time_);
 }
 
-bool Scheduler::remove_from_ready_queue(Process* process) {
+void Scheduler::tick(uint64_t current_time) {
+    current_time_ = current_time;
+    
+    // Periodic boost keeps demoted processes from starving
+    if (algorithm_ == SchedulingAlgorithm::MLFQ && mlfq_boost_interval_ > 0 &&
+        current_time_ - last_boost_time_ >= mlfq_boost_interval_) {
+        for (auto& queue : run_queues_) {
+            queue->boost();
+        }
+        last_boost_time_ = current_time_;
+    }
+    
+    if (run_queues_.size() > 1 && load_balance_interval_ > 0 &&
+        current_time_ - last_balance_time_ >= load_balance_interval_) {
+        balance_load();
+        last_balance_time_ = current_time_;
+    }
+    
+    if (cpu_controller_) {
+        cpu_controller_->tick(current_time_);
+    }
+}
+
+bool Scheduler::add_to_ready_queue(Process* process) {
     if (!process) {
         return false;
     }
+    if (process->is_queued()) {
+        return true;
+    }
+    
+    ProcessState previous = process->get_state();
+    if (!make_ready(process)) {
+        return false;
+    }
     
-    // For Round Robin, we need to search the queue
-    std::queue<Process*> temp_queue;
-    bool found = false;
+    if (is_gang_member(process)) {
+        enqueue_gang(process);
+    } else {
+        enqueue(process, select_core(process));
+    }
+    record_event(process, previous, ProcessState::READY, current_time_);
+    
+    return true;
+}
+
+size_t Scheduler::add_to_ready_queue(Process* const* processes, size_t count) {
+    std::vector<std::vector<Process*>> per_core(run_queues_.size());
+    std::vector<size_t> pending(run_queues_.size(), 0);
+    std::vector<ScheduleEvent> events;
+    if constexpr (SchedulerRecorder::kEnabled) {
+        events.reserve(count);
+    }
     
-    while (!ready_queue_.empty()) {
-        Process* current = ready_queue_.front();
-        ready_queue_.pop();
+    size_t queued = 0;
+    for (size_t i = 0; i < count; ++i) {
+        Process* process = processes[i];
+        if (!process) {
+            continue;
+        }
+        if (process->is_queued()) {
+            queued++;
+            continue;
+        }
         
-        if (current == process) {
-            found = true;
-            process->set_state(ProcessState::TERMINATED);
-            record_event(process, ProcessState::READY, ProcessState::TERMINATED, 0);
+        ProcessState previous = process->get_state();
+        if (!make_ready(process)) {
+            continue;
+        }
+        queued++;
+        
+        uint32_t core;
+        if (is_gang_member(process)) {
+            enqueue_gang(process);
+            core = process->get_core();
+        } else {
+            size_t target = select_core(process, pending.data());
+            per_core[target].push_back(process);
+            pending[target]++;
+            core = static_cast<uint32_t>(target);
+        }
+        if constexpr (SchedulerRecorder::kEnabled) {
+            events.push_back(make_event(process, previous, ProcessState::READY, current_time_, core));
+        }
+    }
+    
+    for (size_t core = 0; core < per_core.size(); ++core) {
+        if (!per_core[core].empty()) {
+            enqueue_batch(per_core[core], core);
+        }
+    }
+    if constexpr (SchedulerRecorder::kEnabled) {
+        recorder_.record(events.data(), events.size());
+    }
+    
+    return queued;
+}
+
+Process* Scheduler::get_next_process(size_t core) {
+    if (core >= run_queues_.size()) {
+        throw std::out_of_range("Core index out of range");
+    }
+    
+    Process* process = run_queues_[core]->pop(current_time_);
+    if (!process) {
+        process = take_grouped(core);
+    }
+    if (!process) {
+        process = steal(core);
+    }
+    
+    if (!process) {
+        core_stats_[core].idle_quanta++;
+        return nullptr;
+    }
+    
+    dispatch(process, core);
+    return process;
+}
+
+size_t Scheduler::get_next_processes(size_t n, Process** out) {
+    if (n > run_queues_.size()) {
+        throw std::out_of_range("Slot count exceeds core count");
+    }
+    
+    std::vector<ScheduleEvent> events;
+    if constexpr (SchedulerRecorder::kEnabled) {
+        events.reserve(n);
+    }
+    size_t dispatched = 0;
+    auto take = [&](size_t core, Process* process) {
+        out[core] = process;
+        mark_dispatched(process, core);
+        dispatched++;
+        if constexpr (SchedulerRecorder::kEnabled) {
+            events.push_back(make_event(process, ProcessState::READY, ProcessState::RUNNING,
+                                        current_time_, static_cast<uint32_t>(core)));
+        }
+    };
+    
+    // Own queues first, so steals only move work no local core claimed
+    std::vector<size_t> idle;
+    for (size_t core = 0; core < n; ++core) {
+        if (out[core]) {
+            continue;
+        }
+        Process* process = run_queues_[core]->pop(current_time_);
+        if (!process) {
+            process = take_grouped(core);
+        }
+        if (process) {
+            take(core, process);
+        } else {
+            idle.push_back(core);
+        }
+    }
+    for (size_t core : idle) {
+        if (Process* process = steal(core)) {
+            take(core, process);
         } else {
-            temp_queue.push(current);
+            core_stats_[core].idle_quanta++;
         }
     }
     
-    // Restore remaining processes
-    ready_queue_ = std::move(temp_queue);
+    if constexpr (SchedulerRecorder::kEnabled) {
+        recorder_.record(events.data(), events.size());
+    }
+    return dispatched;
+}
+
+bool Scheduler::remove_from_ready_queue(Process* process) {
+    if (!process || !process->is_queued()) {
+        return false;
+    }
+    
+    uint32_t core = process->get_core();
+    bool found = (core < run_queues_.size() && run_queues_[core]->erase(process)) ||
+                 (cpu_controller_ && cpu_controller_->erase(process));
+    
+    auto gang = gangs_.find(process->get_group());
+    if (!found && gang != gangs_.end() && gang->second.ready.erase(process)) {
+        gang_ready_count_--;
+        found = true;
+    }
+    
+    if (found) {
+        release_admission(process);
+        process->set_state(ProcessState::TERMINATED);
+        record_event(process, ProcessState::READY, ProcessState::TERMINATED, current_time_);
+    }
     
     return found;
 }
 
+bool Scheduler::update_ready_process(Process* process) {
+    if (!process) {
+        return false;
+    }
+    
+    if (cpu_controller_ && cpu_controller_->erase(process)) {
+        cpu_controller_->push(process);
+        return true;
+    }
+    
+    uint32_t core = process->get_core();
+    return core < run_queues_.size() && run_queues_[core]->update(process);
+}
+
 bool Scheduler::is_ready_queue_empty() const {
-    return ready_queue_.empty();
+    return get_ready_queue_size() == 0;
 }
 
 size_t Scheduler::get_ready_queue_size() const {
-    return ready_queue_.size();
+    size_t total = gang_ready_count_ + (cpu_controller_ ? cpu_controller_->size() : 0);
+    for (const auto& queue : run_queues_) {
+        total += queue->size();
+    }
+    return total;
+}
+
+size_t Scheduler::get_ready_queue_size(size_t core) const {
+    if (core >= run_queues_.size()) {
+        throw std::out_of_range("Core index out of range");
+    }
+    return run_queues_[core]->size();
 }
 
 void Scheduler::clear_ready_queue() {
-    while (!ready_queue_.empty()) {
-        Process* process = ready_queue_.front();
-        ready_queue_.pop();
+    std::vector<Process*> queued;
+    for (auto& queue : run_queues_) {
+        std::vector<Process*> released = queue->release();
+        queued.insert(queued.end(), released.begin(), released.end());
+    }
+    if (cpu_controller_) {
+        std::vector<Process*> released = cpu_controller_->release();
+        queued.insert(queued.end(), released.begin(), released.end());
+    }
+    for (auto& entry : gangs_) {
+        while (Process* process = entry.second.ready.pop_front()) {
+            queued.push_back(process);
+        }
+        entry.second.listed = false;
+    }
+    gang_order_.clear();
+    gang_ready_count_ = 0;
+    
+    for (Process* process : queued) {
+        release_admission(process);
         process->set_state(ProcessState::TERMINATED);
-        record_event(process, ProcessState::READY, ProcessState::TERMINATED, 0);
+        record_event(process, ProcessState::READY, ProcessState::TERMINATED, current_time_);
     }
 }
 
-const std::vector<ScheduleEvent>& Scheduler::get_schedule_history() const {
-    return schedule_history_;
+#if OSRO_SCHEDULER_RECORDER == OSRO_RECORDER_FULL
+const ScheduleHistory& Scheduler::get_schedule_history() const {
+    return recorder_.get_history();
 }
 
-uint64_t Scheduler::simulate_context_switch(Process* from, Process* to, uint64_t timestamp) {
-    // Simulate context switch overhead
-    uint64_t overhead = 1; // 1ms context switch overhead
+ScheduleHistory& Scheduler::get_schedule_history() {
+    return recorder_.get_history();
+}
+#endif
+
+uint64_t Scheduler::simulate_context_switch(Process* from, Process* to, uint64_t timestamp,
+                                           size_t core) {
+    // Cost depends on how much of the incoming working set is still cached
+    uint64_t overhead = cache_model_.get_switch_cost(to, core, timestamp);
     
     if (from) {
+        from->set_last_run(static_cast<uint32_t>(core), timestamp);
         from->set_state(ProcessState::READY);
         record_event(from, ProcessState::RUNNING, ProcessState::READY, timestamp);
     }
@@ -119,6 +833,9 @@ uint64_t Scheduler::simulate_context_switch(Process* from, Process* to, uint64_t
     }
     
     context_switches_++;
+    if (core < core_stats_.size()) {
+        core_stats_[core].switch_overhead += overhead;
+    }
     return overhead;
 }
 
@@ -126,21 +843,718 @@ size_t Scheduler::get_context_switch_count() const noexcept {
     return context_switches_;
 }
 
+size_t Scheduler::get_deadline_miss_count() const noexcept {
+    return deadline_misses_;
+}
+
+size_t Scheduler::get_admission_rejection_count() const noexcept {
+    return admission_rejections_;
+}
+
+double Scheduler::get_edf_utilization() const noexcept {
+    return edf_utilization_;
+}
+
+const CoreStats& Scheduler::get_core_stats(size_t core) const {
+    if (core >= core_stats_.size()) {
+        throw std::out_of_range("Core index out of range");
+    }
+    return core_stats_[core];
+}
+
+double Scheduler::get_core_utilization(size_t core) const {
+    const CoreStats& stats = get_core_stats(core);
+    if (current_time_ == 0) {
+        return 0.0;
+    }
+    return std::min(1.0, static_cast<double>(stats.busy_time) / current_time_);
+}
+
+const WaitStats& Scheduler::get_wait_stats(ProcessPriority priority) const noexcept {
+    return wait_stats_[priority_index(priority)];
+}
+
+const SloStats& Scheduler::get_slo_stats(ProcessPriority priority) const noexcept {
+    return slo_stats_[priority_index(priority)];
+}
+
+size_t Scheduler::get_migration_count() const noexcept {
+    return migrations_;
+}
+
+SchedulerSnapshot Scheduler::snapshot(const ProcessManager& processes) const {
+    if (is_group_scheduling()) {
+        throw std::runtime_error("Cannot snapshot while CPU groups hold the ready processes");
+    }
+    if (!lock_manager_.is_idle()) {
+        throw std::runtime_error("Cannot snapshot while a lock is held or awaited");
+    }
+    
+    SchedulerState state;
+    state.algorithm = algorithm_;
+    state.time_slice = time_slice_;
+    state.mlfq_levels = run_queues_[0]->get_mlfq_queue().get_level_count();
+    state.mlfq_boost_interval = mlfq_boost_interval_;
+    state.target_latency = target_latency_;
+    state.min_granularity = min_granularity_;
+    state.edf_utilization_bound = edf_utilization_bound_;
+    state.priority_aging_interval = priority_aging_interval_;
+    state.adaptive_target = adaptive_target_;
+    state.adaptive_min_quantum = adaptive_min_quantum_;
+    state.adaptive_max_quantum = adaptive_max_quantum_;
+    state.load_balance_interval = load_balance_interval_;
+    state.cache_model = cache_model_;
+    state.lock_protocol = lock_protocol_;
+    
+    state.current_time = current_time_;
+    state.last_boost_time = last_boost_time_;
+    state.last_balance_time = last_balance_time_;
+    state.context_switches = context_switches_;
+    state.deadline_misses = deadline_misses_;
+    state.admission_rejections = admission_rejections_;
+    state.migrations = migrations_;
+    state.preemptions = preemptions_;
+    state.preemption_overhead = preemption_overhead_;
+    state.edf_utilization = edf_utilization_;
+    for (const auto& entry : admitted_utilization_) {
+        state.admitted_utilization.emplace_back(entry.first->get_pid(), entry.second);
+    }
+    for (const Process* process : rejected_) {
+        state.rejected.push_back(process->get_pid());
+    }
+    state.wait_stats = wait_stats_;
+    state.slo_stats = slo_stats_;
+    state.slo_sketches = slo_sketches_;
+    state.burst_sketch = burst_sketch_;
+    state.gang_stats = gang_stats_;
+    state.core_stats = core_stats_;
+    
+    // Structure order, so rebuilding the queues reproduces every tie
+    for (const auto& queue : run_queues_) {
+        state.clocks.push_back(queue->get_clocks());
+        std::vector<uint32_t> queued;
+        queued.reserve(queue->size());
+        queue->for_each([&queued](Process* process) {
+            queued.push_back(process->get_pid());
+        });
+        state.run_queues.push_back(std::move(queued));
+    }
+    for (const auto& entry : gangs_) {
+        if (entry.second.ready.empty() && !entry.second.listed) {
+            continue;
+        }
+        SchedulerState::Gang gang;
+        gang.group = entry.first;
+        gang.listed = entry.second.listed;
+        entry.second.ready.for_each([&gang](Process* process) {
+            gang.ready.push_back(process->get_pid());
+        });
+        state.gangs.push_back(std::move(gang));
+    }
+    state.gang_order.assign(gang_order_.begin(), gang_order_.end());
+    state.gang_ready_count = gang_ready_count_;
+    
+    const auto& all = processes.get_all_processes();
+    state.processes.reserve(all.size());
+    for (const Process* process : all) {
+        state.processes.push_back(process->save_context());
+    }
+    
+    return SchedulerSnapshot(std::move(state));
+}
+
+void Scheduler::restore(const SchedulerSnapshot& snapshot, const ProcessManager& processes) {
+    const SchedulerState& state = snapshot.get_state();
+    if (cpu_controller_ && state.algorithm == SchedulingAlgorithm::FAIR) {
+        throw std::runtime_error("Cannot restore a FAIR snapshot while CPU groups are attached");
+    }
+    
+    // Resolve every PID before touching anything
+    auto lookup = [&processes](uint32_t pid) {
+        Process* process = processes.get_process(pid);
+        if (!process) {
+            throw std::invalid_argument("Snapshot process " + std::to_string(pid) + " does not exist");
+        }
+        return process;
+    };
+    auto resolve = [&lookup](const std::vector<uint32_t>& pids) {
+        std::vector<Process*> resolved;
+        resolved.reserve(pids.size());
+        for (uint32_t pid : pids) {
+            resolved.push_back(lookup(pid));
+        }
+        return resolved;
+    };
+    std::vector<Process*> targets;
+    targets.reserve(state.processes.size());
+    for (const ProcessContext& context : state.processes) {
+        targets.push_back(lookup(context.pid));
+    }
+    std::vector<Process*> rejected = resolve(state.rejected);
+    std::vector<std::vector<Process*>> queued;
+    for (const auto& pids : state.run_queues) {
+        queued.push_back(resolve(pids));
+    }
+    std::vector<std::vector<Process*>> gang_ready;
+    for (const SchedulerState::Gang& gang : state.gangs) {
+        gang_ready.push_back(resolve(gang.ready));
+    }
+    
+    // Only queues emptied below may hold a process, or restoring its context
+    // would throw halfway through
+    for (const Process* process : targets) {
+        if (process->is_queued() && !holds(process)) {
+            throw std::runtime_error("Process " + std::to_string(process->get_pid()) +
+                                     " is queued outside the scheduler");
+        }
+    }
+    
+    // Empty the ready structures without terminating anyone
+    for (auto& queue : run_queues_) {
+        queue->release();
+    }
+    if (cpu_controller_) {
+        cpu_controller_->release();
+    }
+    for (auto& entry : gangs_) {
+        entry.second.ready.clear();
+    }
+    gangs_.clear();
+    lock_manager_.reset();
+    
+    algorithm_ = state.algorithm;
+    set_core_count(state.clocks.size());
+    for (size_t core = 0; core < run_queues_.size(); ++core) {
+        RunQueue& queue = *run_queues_[core];
+        queue.set_algorithm(algorithm_);
+        queue.set_mlfq_levels(state.mlfq_levels);
+        queue.set_clocks(state.clocks[core]);
+    }
+    
+    time_slice_ = state.time_slice;
+    mlfq_boost_interval_ = state.mlfq_boost_interval;
+    target_latency_ = state.target_latency;
+    min_granularity_ = state.min_granularity;
+    edf_utilization_bound_ = state.edf_utilization_bound;
+    priority_aging_interval_ = state.priority_aging_interval;
+    adaptive_target_ = state.adaptive_target;
+    adaptive_min_quantum_ = state.adaptive_min_quantum;
+    adaptive_max_quantum_ = state.adaptive_max_quantum;
+    load_balance_interval_ = state.load_balance_interval;
+    cache_model_ = state.cache_model;
+    lock_protocol_ = state.lock_protocol;
+    
+    current_time_ = state.current_time;
+    last_boost_time_ = state.last_boost_time;
+    last_balance_time_ = state.last_balance_time;
+    context_switches_ = state.context_switches;
+    deadline_misses_ = state.deadline_misses;
+    admission_rejections_ = state.admission_rejections;
+    migrations_ = state.migrations;
+    preemptions_ = state.preemptions;
+    preemption_overhead_ = state.preemption_overhead;
+    edf_utilization_ = state.edf_utilization;
+    admitted_utilization_.clear();
+    for (const auto& entry : state.admitted_utilization) {
+        admitted_utilization_.emplace(lookup(entry.first), entry.second);
+    }
+    rejected_.clear();
+    rejected_.insert(rejected.begin(), rejected.end());
+    wait_stats_ = state.wait_stats;
+    slo_stats_ = state.slo_stats;
+    slo_sketches_ = state.slo_sketches;
+    burst_sketch_ = state.burst_sketch;
+    gang_stats_ = state.gang_stats;
+    core_stats_ = state.core_stats;
+    std::fill(slice_runtime_.begin(), slice_runtime_.end(), 0);
+    for (size_t cls = 0; cls < slo_stats_.size(); ++cls) {
+        apply_slo_scale(cls);
+    }
+    
+    for (size_t i = 0; i < targets.size(); ++i) {
+        targets[i]->restore_context(state.processes[i]);
+    }
+    
+    // Heaps are rebuilt from their own array order, which heapify leaves as is
+    for (size_t core = 0; core < run_queues_.size(); ++core) {
+        run_queues_[core]->assign(std::move(queued[core]));
+    }
+    for (size_t i = 0; i < state.gangs.size(); ++i) {
+        GangQueue& gang = gangs_[state.gangs[i].group];
+        gang.listed = state.gangs[i].listed;
+        for (Process* process : gang_ready[i]) {
+            gang.ready.push_back(process);
+        }
+    }
+    gang_order_.assign(state.gang_order.begin(), state.gang_order.end());
+    gang_ready_count_ = state.gang_ready_count;
+}
+
 void Scheduler::reset() {
     clear_ready_queue();
-    schedule_history_.clear();
+    recorder_.clear();
     context_switches_ = 0;
+    current_time_ = 0;
+    last_boost_time_ = 0;
+    last_balance_time_ = 0;
+    migrations_ = 0;
+    preemptions_ = 0;
+    preemption_overhead_ = 0;
+    if (is_adaptive_quantum()) {
+        burst_sketch_.reset(adaptive_target_);
+    }
+    for (auto& queue : run_queues_) {
+        queue->reset();
+    }
+    if (cpu_controller_) {
+        cpu_controller_->reset();
+    }
+    std::fill(core_stats_.begin(), core_stats_.end(), CoreStats{});
+    std::fill(slice_runtime_.begin(), slice_runtime_.end(), 0);
+    gang_stats_ = GangStats{};
+    wait_stats_.fill(WaitStats{});
+    for (size_t cls = 0; cls < slo_stats_.size(); ++cls) {
+        // Keep each SLO, restart its attainment
+        SloStats& slo = slo_stats_[cls];
+        slo.dispatches = 0;
+        slo.met = 0;
+        slo.estimate = 0.0;
+        slo.weight = 1.0;
+        if (slo.target != 0) {
+            slo_sketches_[cls].reset(slo.quantile);
+        }
+        apply_slo_scale(cls);
+    }
+    admitted_utilization_.clear();
+    rejected_.clear();
+    edf_utilization_ = 0.0;
+    deadline_misses_ = 0;
+    admission_rejections_ = 0;
+    lock_manager_.reset();
+}
+
+bool Scheduler::make_ready(Process* process) {
+    if (algorithm_ == SchedulingAlgorithm::EDF) {
+        if (!admit(process)) {
+            // Count the process, not every retry of it
+            if (rejected_.insert(process).second) {
+                admission_rejections_++;
+            }
+            return false;
+        }
+        rejected_.erase(process);
+    }
+    
+    process->set_state(ProcessState::READY);
+    
+    // Key once so aging never needs a queue rescan
+    process->set_ready_time(current_time_);
+    process->set_aging_key(aging_key(process));
+    return true;
+}
+
+uint64_t Scheduler::aging_key(const Process* process) const noexcept {
+    return get_aging_key(process->get_ready_time(), process->get_priority(), priority_aging_interval_);
+}
+
+void Scheduler::enqueue_gang(Process* process) {
+    GangQueue& gang = gangs_[process->get_group()];
+    gang.ready.push_back(process);
+    gang_ready_count_++;
+    if (!gang.listed) {
+        gang_order_.push_back(process->get_group());
+        gang.listed = true;
+    }
 }
 
-void Scheduler::convert_to_priority_queue() {
-    // This is a simplified implementation
-    // In a full implementation, we would convert between queue types
-    // based on the algorithm change
+Process* Scheduler::steal(size_t core) {
+    if (run_queues_.size() < 2) {
+        return nullptr;
+    }
+    
+    // Try the busiest cores first
+    std::vector<size_t> victims;
+    for (size_t other = 0; other < run_queues_.size(); ++other) {
+        if (other != core && !run_queues_[other]->empty()) {
+            victims.push_back(other);
+        }
+    }
+    std::sort(victims.begin(), victims.end(), [this](size_t a, size_t b) {
+        return run_queues_[a]->size() > run_queues_[b]->size();
+    });
+    for (size_t victim : victims) {
+        if (Process* process = detach_migratable(victim, core)) {
+            core_stats_[core].steals++;
+            return process;
+        }
+    }
+    return nullptr;
+}
+
+size_t Scheduler::select_core(const Process* process, const size_t* pending) const {
+    // A mask that excludes every configured core is ignored
+    bool honour_mask = false;
+    for (size_t core = 0; core < run_queues_.size() && !honour_mask; ++core) {
+        honour_mask = process->can_run_on(core);
+    }
+    auto allowed = [process, honour_mask](size_t core) {
+        return !honour_mask || process->can_run_on(core);
+    };
+    auto load = [this, pending](size_t core) {
+        return run_queues_[core]->size() + (pending ? pending[core] : 0);
+    };
+    
+    size_t best = run_queues_.size();
+    for (size_t core = 0; core < run_queues_.size(); ++core) {
+        if (allowed(core) &&
+            (best == run_queues_.size() || load(core) < load(best))) {
+            best = core;
+        }
+    }
+    
+    // Stay on the last core while its cache is warm and it is not clearly busier
+    uint32_t last = process->get_last_core();
+    if (last < run_queues_.size() && last != best && allowed(last) &&
+        load(last) <= load(best) + 1 &&
+        cache_model_.get_warmth(process, last, current_time_) > 0.0) {
+        return last;
+    }
+    return best;
+}
+
+bool Scheduler::may_run_on(const Process* process, size_t core) const {
+    if (process->can_run_on(core)) {
+        return true;
+    }
+    
+    // A mask that excludes every configured core is ignored
+    for (size_t other = 0; other < run_queues_.size(); ++other) {
+        if (process->can_run_on(other)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Scheduler::is_gang_member(const Process* process) const {
+    return gang_source_ && process->get_group() != 0 &&
+           gang_source_->get_group_members(process->get_group()).size() <= run_queues_.size();
+}
+
+bool Scheduler::holds(const Process* process) const {
+    for (const auto& queue : run_queues_) {
+        if (queue->contains(process)) {
+            return true;
+        }
+    }
+    auto gang = gangs_.find(process->get_group());
+    if (gang != gangs_.end() && gang->second.ready.contains(process)) {
+        return true;
+    }
+    return (cpu_controller_ && cpu_controller_->contains(process)) ||
+           lock_manager_.is_waiting(process);
+}
+
+bool Scheduler::place_gang(const GangQueue& gang, std::vector<Process*>& slots) const {
+    std::vector<Process*> plan = slots;
+    bool placed_all = true;
+    
+    // Prefer each member's cache-warm core, then any free core it may use
+    gang.ready.for_each([&](Process* member) {
+        if (!placed_all) {
+            return;
+        }
+        size_t chosen = plan.size();
+        uint32_t last = member->get_last_core();
+        if (last < plan.size() && !plan[last] && member->can_run_on(last)) {
+            chosen = last;
+        }
+        for (size_t core = 0; chosen == plan.size() && core < plan.size(); ++core) {
+            if (!plan[core] && member->can_run_on(core)) {
+                chosen = core;
+            }
+        }
+        if (chosen == plan.size()) {
+            placed_all = false;
+            return;
+        }
+        plan[chosen] = member;
+    });
+    
+    if (placed_all) {
+        slots.swap(plan);
+    }
+    return placed_all;
+}
+
+Process* Scheduler::take_grouped(size_t core) {
+    if (!is_group_scheduling()) {
+        return nullptr;
+    }
+    
+    // The hierarchy's choice waits for a core it may run on
+    Process* process = cpu_controller_->top();
+    if (!process || !may_run_on(process, core)) {
+        return nullptr;
+    }
+    cpu_controller_->erase(process);
+    return process;
+}
+
+void Scheduler::requeue(std::vector<Process*> displaced) {
+    if (is_group_scheduling()) {
+        for (auto& queue : run_queues_) {
+            std::vector<Process*> queued = queue->release();
+            displaced.insert(displaced.end(), queued.begin(), queued.end());
+        }
+    }
+    for (Process* process : displaced) {
+        enqueue(process, select_core(process));
+    }
+}
+
+void Scheduler::mark_dispatched(Process* process, size_t core) {
+    if (process->get_core() != Process::kNoCore && process->get_core() != core) {
+        core_stats_[core].migrations++;
+        migrations_++;
+    }
+    process->set_core(static_cast<uint32_t>(core));
+    core_stats_[core].dispatches++;
+    slice_runtime_[core] = 0;
+    
+    WaitStats& waits = wait_stats_[priority_index(process->get_priority())];
+    uint64_t wait = current_time_ > process->get_ready_time() ?
+                    current_time_ - process->get_ready_time() : 0;
+    waits.max_wait = std::max(waits.max_wait, wait);
+    waits.total_wait += wait;
+    waits.dispatches++;
+    record_slo_wait(priority_index(process->get_priority()), wait);
+    
+    process->set_state(ProcessState::RUNNING);
+}
+
+void Scheduler::record_slo_wait(size_t cls, uint64_t wait) {
+    SloStats& slo = slo_stats_[cls];
+    if (slo.target == 0) {
+        return;
+    }
+    
+    P2Quantile& sketch = slo_sketches_[cls];
+    sketch.add(static_cast<double>(wait));
+    slo.dispatches++;
+    if (wait <= slo.target) {
+        slo.met++;
+    }
+    slo.estimate = sketch.get();
+    
+    // Proportional feedback: a class over its target grows more urgent, one
+    // with slack lends its share to the others
+    if (sketch.get_count() >= kSloWarmup) {
+        double weight = std::clamp(slo.estimate / static_cast<double>(slo.target),
+                                   kMinSloWeight, kMaxSloWeight);
+        if (weight != slo.weight) {
+            slo.weight = weight;
+            apply_slo_scale(cls);
+        }
+    }
+}
+
+void Scheduler::apply_slo_scale(size_t cls) {
+    const SloStats& slo = slo_stats_[cls];
+    double scale = slo.target != 0 ? slo.weight / static_cast<double>(slo.target)
+                                   : SloQueue::kDefaultScale;
+    for (auto& queue : run_queues_) {
+        queue->set_slo_scale(cls, scale);
+    }
+}
+
+void Scheduler::dispatch(Process* process, size_t core) {
+    mark_dispatched(process, core);
+    record_event(process, ProcessState::READY, ProcessState::RUNNING, current_time_);
+}
+
+void Scheduler::enqueue(Process* process, size_t core) {
+    if (is_group_scheduling()) {
+        place_fair(process, cpu_controller_->get_queue(process));
+        cpu_controller_->push(process);
+        return;
+    }
+    
+    RunQueue& queue = *run_queues_[core];
+    if (algorithm_ == SchedulingAlgorithm::FAIR) {
+        place_fair(process, queue.get_fair_queue());
+    }
+    
+    if (process->get_core() != Process::kNoCore && process->get_core() != core) {
+        core_stats_[core].migrations++;
+        migrations_++;
+    }
+    process->set_core(static_cast<uint32_t>(core));
+    queue.push(process);
+}
+
+void Scheduler::enqueue_batch(const std::vector<Process*>& processes, size_t core) {
+    if (is_group_scheduling()) {
+        for (Process* process : processes) {
+            enqueue(process, core);
+        }
+        return;
+    }
+    
+    RunQueue& queue = *run_queues_[core];
+    for (Process* process : processes) {
+        if (algorithm_ == SchedulingAlgorithm::FAIR) {
+            place_fair(process, queue.get_fair_queue());
+        }
+        if (process->get_core() != Process::kNoCore && process->get_core() != core) {
+            core_stats_[core].migrations++;
+            migrations_++;
+        }
+        process->set_core(static_cast<uint32_t>(core));
+    }
+    queue.push_batch(processes.data(), processes.size());
+}
+
+Process* Scheduler::detach_migratable(size_t from, size_t to) {
+    Process* coldest = nullptr;
+    double coldest_warmth = 0.0;
+    size_t examined = 0;
+    
+    run_queues_[from]->for_each([&](Process* candidate) {
+        if (examined >= kMigrationScanLimit || !candidate->can_run_on(to)) {
+            return;
+        }
+        examined++;
+        double warmth = cache_model_.get_warmth(candidate, from, current_time_);
+        if (!coldest || warmth < coldest_warmth) {
+            coldest = candidate;
+            coldest_warmth = warmth;
+        }
+    });
+    
+    if (coldest) {
+        run_queues_[from]->erase(coldest);
+    }
+    return coldest;
+}
+
+Process* Scheduler::migrate_one(size_t from, size_t to) {
+    Process* process = detach_migratable(from, to);
+    if (process) {
+        enqueue(process, to);
+    }
+    return process;
+}
+
+void Scheduler::balance_load() {
+    if (run_queues_.size() < 2) {
+        return;
+    }
+    
+    // Move one process at a time from the longest to the shortest queue
+    for (;;) {
+        size_t busiest = 0;
+        size_t idlest = 0;
+        for (size_t core = 1; core < run_queues_.size(); ++core) {
+            if (run_queues_[core]->size() > run_queues_[busiest]->size()) {
+                busiest = core;
+            }
+            if (run_queues_[core]->size() < run_queues_[idlest]->size()) {
+                idlest = core;
+            }
+        }
+        if (run_queues_[busiest]->size() <= run_queues_[idlest]->size() + 1 ||
+            !migrate_one(busiest, idlest)) {
+            break;
+        }
+    }
+}
+
+uint64_t Scheduler::get_target_latency() const noexcept {
+    return target_latency_ != 0 ? target_latency_ : time_slice_ * 4;
+}
+
+uint64_t Scheduler::get_min_granularity() const noexcept {
+    if (min_granularity_ != 0) {
+        return min_granularity_;
+    }
+    return std::max<uint64_t>(1, std::min(time_slice_ / 2, get_target_latency()));
+}
+
+void Scheduler::place_fair(Process* process, const FairQueue& queue) const {
+    uint64_t min_vruntime = queue.get_min_vruntime();
+    
+    if (process->get_remaining_time() == process->get_burst_time()) {
+        // New processes start level with the queue instead of at zero
+        process->set_vruntime(std::max(process->get_vruntime(), min_vruntime));
+    } else {
+        // Returning sleepers get at most half a period of credit
+        uint64_t credit = FairQueue::to_vruntime(get_target_latency() / 2, ProcessPriority::MEDIUM);
+        uint64_t floor = (min_vruntime > credit) ? min_vruntime - credit : 0;
+        process->set_vruntime(std::max(process->get_vruntime(), floor));
+    }
+}
+
+bool Scheduler::admit(const Process* process) {
+    if (!process->has_deadline() || admitted_utilization_.count(process) != 0) {
+        return true;
+    }
+    
+    uint64_t deadline = process->get_relative_deadline();
+    uint64_t period = process->get_period();
+    uint64_t window = (deadline == 0) ? period :
+                      (period == 0) ? deadline : std::min(deadline, period);
+    double utilization = static_cast<double>(process->get_burst_time()) / window;
+    
+    if (edf_utilization_ + utilization > edf_utilization_bound_) {
+        return false;
+    }
+    
+    admitted_utilization_.emplace(process, utilization);
+    edf_utilization_ += utilization;
+    return true;
+}
+
+void Scheduler::release_admission(const Process* process) {
+    auto it = admitted_utilization_.find(process);
+    if (it == admitted_utilization_.end()) {
+        return;
+    }
+    
+    edf_utilization_ -= it->second;
+    admitted_utilization_.erase(it);
+    if (admitted_utilization_.empty()) {
+        edf_utilization_ = 0.0; // Drop accumulated rounding error
+    }
+}
+
+void Scheduler::end_burst(Process* process) {
+    uint64_t burst = process->get_burst_elapsed();
+    if (burst == 0) {
+        return;
+    }
+    
+    // Exponential average with weight 1/2, as in classic SJF burst prediction
+    uint64_t estimate = process->get_burst_estimate();
+    process->set_burst_estimate(estimate == 0 ? burst : (estimate + burst) / 2);
+    process->set_burst_elapsed(0);
+    
+    if (is_adaptive_quantum()) {
+        burst_sketch_.add(static_cast<double>(burst));
+    }
 }
 
 void Scheduler::record_event(Process* process, ProcessState old_state, 
                            ProcessState new_state, uint64_t timestamp) {
-    schedule_history_.emplace_back(timestamp, process, old_state, new_state);
+    // Compiled out entirely with the null recorder
+    if constexpr (SchedulerRecorder::kEnabled) {
+        recorder_.record(make_event(process, old_state, new_state, timestamp, process->get_core()));
+    } else {
+        (void)process;
+        (void)old_state;
+        (void)new_state;
+        (void)timestamp;
+    }
 }
 
 } // namespace osro
\ No newline at end of file
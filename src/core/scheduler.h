@@ -2,41 +2,96 @@
 
 #include "process.h"
 #include "process_manager.h"
+#include "cache_model.h"
+#include "cpu_controller.h"
+#include "lock_manager.h"
+#include "run_queue.h"
+#include "event_recorder.h"
+#include "../utils/p2_quantile.h"
+#include <array>
+#include <deque>
 #include <queue>
 #include <vector>
 #include <functional>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace osro {
 
+class SchedulerSnapshot;
+
+/**
+ * @brief Get display name of a scheduling algorithm
+ * @param algorithm Scheduling algorithm
+ * @return const char* Short algorithm name
+ */
+const char* to_string(SchedulingAlgorithm algorithm) noexcept;
+
+/**
+ * @brief Per-core scheduling statistics
+ */
+struct CoreStats {
+    uint64_t busy_time = 0;   // CPU time charged on this core
+    size_t dispatches = 0;    // Processes dispatched on this core
+    size_t migrations = 0;    // Processes moved onto this core from another
+    size_t steals = 0;        // Dispatches taken from another core's queue
+    uint64_t switch_overhead = 0; // Context switch cost charged on this core
+    size_t idle_quanta = 0;   // Dispatch requests that found no work anywhere
+    size_t preemptions = 0;   // Running processes displaced by a shorter arrival
+};
+
 /**
- * @brief Enumeration of scheduling algorithms
+ * @brief Ready-queue waiting statistics of one priority level
  */
-enum class SchedulingAlgorithm {
-    ROUND_ROBIN,      // Time-slice based scheduling
-    PRIORITY,         // Priority-based scheduling
-    SHORTEST_JOB_FIRST // SJF scheduling
+struct WaitStats {
+    uint64_t max_wait = 0;    // Longest single wait in milliseconds
+    uint64_t total_wait = 0;  // Sum of waits in milliseconds
+    size_t dispatches = 0;    // Dispatches contributing to the totals
 };
 
 /**
- * @brief Represents a scheduling event
+ * @brief Latency SLO of one priority level and how well it is met
  */
-struct ScheduleEvent {
-    uint64_t timestamp;
-    Process* process;
-    ProcessState old_state;
-    ProcessState new_state;
-    
-    ScheduleEvent(uint64_t time, Process* proc, ProcessState old_s, ProcessState new_s)
-        : timestamp(time), process(proc), old_state(old_s), new_state(new_s) {}
+struct SloStats {
+    uint64_t target = 0;      // Waiting-time target in milliseconds, 0 = no SLO
+    double quantile = 0.0;    // Fraction of dispatches that must wait at most target
+    size_t dispatches = 0;    // Dispatches observed since the SLO was set
+    size_t met = 0;           // Dispatches that waited at most target
+    double estimate = 0.0;    // Streaming estimate of the quantile wait in milliseconds
+    double weight = 1.0;      // Urgency weight the SLO policy currently applies
+};
+
+/**
+ * @brief Gang scheduling statistics
+ */
+struct GangStats {
+    size_t quanta = 0;            // Quanta planned by schedule_gangs()
+    size_t dispatches = 0;        // Gangs co-scheduled
+    size_t deferrals = 0;         // Complete gangs deferred for lack of free cores
+    size_t incomplete = 0;        // Gangs held back because a member was not ready
+    size_t fragmented_slots = 0;  // Free cores left over while a complete gang was deferred
 };
 
 /**
  * @brief Implements CPU scheduling algorithms
  * 
  * This class provides multiple scheduling algorithms including
- * Round Robin, Priority-based, and Shortest Job First. It simulates
+ * Round Robin, Priority-based, Shortest Job First, a multilevel
+ * feedback queue, a CFS-style fair scheduler, Earliest Deadline
+ * First for real-time processes, lottery/stride proportional share
+ * scheduling with tickets derived from priority and a policy that
+ * trades priority classes off against tail-latency SLOs. It simulates
  * context switching and maintains scheduling history for analysis.
+ * 
+ * On a multi-core configuration every core owns a run queue. New
+ * processes go to the least loaded core, an idle core steals from the
+ * busiest one and a periodic balancer evens out queue lengths. Affinity
+ * masks are honoured everywhere, a returning process goes back to its
+ * cache-warm core unless that core is clearly busier, and context switch
+ * cost grows with the time since the process last ran on the core.
+ * Optionally, process groups are gang scheduled: all members run in the
+ * same quantum on different cores, or none of them runs.
  */
 class Scheduler {
 public:
@@ -59,17 +114,376 @@ public:
      */
     void set_time_slice(uint64_t time_slice);
 
+    /**
+     * @brief Configure the multilevel feedback queue
+     * @param levels Number of priority levels (1 to 64)
+     * @param boost_interval Time between priority boosts in milliseconds (0 disables)
+     */
+    void set_mlfq_parameters(size_t levels, uint64_t boost_interval);
+
+    /**
+     * @brief Configure the fair scheduler
+     * 
+     * Every runnable process should run once per target latency; when too
+     * many are runnable the period stretches so no slice drops below the
+     * minimum granularity. A value of 0 derives the knob from the time
+     * slice (4x for the latency, 1/2 for the granularity).
+     * 
+     * @param target_latency Scheduling period in milliseconds (0 = derive)
+     * @param min_granularity Minimum slice in milliseconds (0 = derive)
+     */
+    void set_fair_parameters(uint64_t target_latency, uint64_t min_granularity);
+
+    /**
+     * @brief Configure priority aging
+     * 
+     * A waiting process gains one priority level per interval, so a LOW
+     * process catches up with a CRITICAL one after 3 intervals. Rather
+     * than rescanning the queue, each process is keyed once on enqueue
+     * (see get_aging_key); comparing keys is the same as comparing aged
+     * priorities at any later time. Off by default; takes effect for
+     * processes enqueued afterwards.
+     * 
+     * @param interval Wait per priority level in milliseconds (0 = strict priority)
+     */
+    void set_priority_aging(uint64_t interval);
+
+    /**
+     * @brief Set a tail-latency SLO for a priority level
+     * 
+     * The level's ready-queue waits are fed to a P-square sketch of the
+     * given quantile under every algorithm, so attainment can be compared
+     * across policies. The SLO algorithm serves the priority class whose
+     * oldest waiter has the highest urgency, wait * weight / target, where
+     * the weight is the estimated quantile wait over the target, clamped
+     * to [0.25, 4]. A class missing its target is thus served earlier and
+     * one with slack yields to the others. Levels without an SLO behave
+     * as if they had a fixed 1 s target. Restarts the level's statistics.
+     * 
+     * @param priority Priority level
+     * @param target Waiting-time target in milliseconds (0 removes the SLO)
+     * @param quantile Quantile the target applies to, strictly between 0 and 1
+     */
+    void set_latency_slo(ProcessPriority priority, uint64_t target, double quantile = 0.99);
+
+    /**
+     * @brief Configure the adaptive Round Robin quantum
+     * 
+     * Round Robin then sizes its quantum from observed CPU bursts (run
+     * time between becoming runnable and blocking or finishing). A P-square
+     * sketch tracks the target_fraction quantile of completed bursts, and
+     * that quantile, clamped to [min_quantum, max_quantum], is the quantum,
+     * so about target_fraction of bursts finish within one slice. A process
+     * whose exponentially averaged burst predicts it will finish within
+     * half a quantum more gets that time instead of a context switch. The
+     * fixed time slice is used until five bursts have been observed.
+     * 
+     * @param target_fraction Fraction of bursts that should fit one slice (0 = fixed slice)
+     * @param min_quantum Smallest quantum in milliseconds
+     * @param max_quantum Largest quantum in milliseconds
+     */
+    void set_adaptive_quantum(double target_fraction, uint64_t min_quantum = 5,
+                              uint64_t max_quantum = 100);
+
+    /**
+     * @brief Check whether Round Robin uses the adaptive quantum
+     * @return bool True if enabled
+     */
+    bool is_adaptive_quantum() const noexcept;
+
+    /**
+     * @brief Get the current adaptive Round Robin quantum
+     * @return uint64_t Quantum in milliseconds (the fixed slice while warming up)
+     */
+    uint64_t get_adaptive_quantum() const;
+
+    /**
+     * @brief Set the EDF admission utilization bound
+     * @param bound Maximum total utilization of admitted real-time processes
+     */
+    void set_edf_utilization_bound(double bound);
+
+    /**
+     * @brief Set number of simulated cores, redistributing queued processes
+     * @param cores Number of cores (at least 1)
+     */
+    void set_core_count(size_t cores);
+
+    /**
+     * @brief Get number of simulated cores
+     * @return size_t Core count
+     */
+    size_t get_core_count() const noexcept;
+
+    /**
+     * @brief Set interval between load-balancing passes
+     * @param interval Interval in milliseconds (0 disables periodic balancing)
+     */
+    void set_load_balance_interval(uint64_t interval);
+
+    /**
+     * @brief Set the cache warmth model used for switch costs and placement
+     * @param model Cache model
+     */
+    void set_cache_model(const CacheModel& model);
+
+    /**
+     * @brief Get the cache warmth model
+     * @return const CacheModel& Cache model
+     */
+    const CacheModel& get_cache_model() const noexcept;
+
+    /**
+     * @brief Enable or disable gang scheduling of process groups
+     * 
+     * While enabled, members of a group no larger than the core count are
+     * held in a per-group queue and only run through schedule_gangs().
+     * 
+     * @param process_manager Source of group membership, nullptr disables
+     */
+    void set_gang_scheduling(const ProcessManager* process_manager);
+
+    /**
+     * @brief Check whether gang scheduling is enabled
+     * @return bool True if enabled
+     */
+    bool is_gang_scheduling() const noexcept;
+
+    /**
+     * @brief Co-schedule process groups for the next quantum
+     * 
+     * Walks the ready gangs in round-robin order and dispatches every
+     * member of a gang on distinct cores, or none of them: gangs with a
+     * member that is not ready are held back and gangs that do not fit
+     * on the remaining free cores are deferred to a later quantum.
+     * 
+     * @return std::vector<Process*> Process per core, nullptr where the
+     *         core is free for get_next_process()
+     */
+    std::vector<Process*> schedule_gangs();
+
+    /**
+     * @brief Get gang scheduling statistics
+     * @return const GangStats& Gang statistics
+     */
+    const GangStats& get_gang_stats() const noexcept;
+
+    /**
+     * @brief Attach a CPU group hierarchy to the fair scheduler
+     * 
+     * While attached and the algorithm is FAIR, runnable processes are
+     * queued in the hierarchy instead of the per-core run queues and every
+     * core picks from it, so group weights and quotas hold across cores.
+     * Slices are cut short where a group's remaining quota is smaller.
+     * Other algorithms leave the hierarchy unused.
+     * 
+     * @param controller Group hierarchy (must outlive its use), nullptr detaches
+     */
+    void set_cpu_controller(CpuController* controller);
+
+    /**
+     * @brief Get the attached CPU group hierarchy
+     * @return const CpuController* Hierarchy, nullptr if none is attached
+     */
+    const CpuController* get_cpu_controller() const noexcept;
+
+    /**
+     * @brief Check whether dispatch goes through the CPU group hierarchy
+     * @return bool True if a hierarchy is attached and the algorithm is FAIR
+     */
+    bool is_group_scheduling() const noexcept;
+
+    /**
+     * @brief Select how mutex holders are boosted to bound priority inversion
+     * 
+     * Takes effect at each holder's next lock operation.
+     * 
+     * @param protocol Lock protocol
+     */
+    void set_lock_protocol(LockProtocol protocol);
+
+    /**
+     * @brief Get the lock protocol
+     * @return LockProtocol Current protocol
+     */
+    LockProtocol get_lock_protocol() const noexcept;
+
+    /**
+     * @brief Get the mutexes and semaphores processes synchronize on
+     * @return LockManager& Lock table
+     */
+    LockManager& get_lock_manager() noexcept;
+    const LockManager& get_lock_manager() const noexcept;
+
+    /**
+     * @brief Change a process's effective priority, re-keying it if ready
+     * 
+     * A ready process keeps its original ready time, so a boost does not
+     * also reset its aging.
+     * 
+     * @param process Process to change
+     * @param priority New effective priority
+     */
+    void set_effective_priority(Process* process, ProcessPriority priority);
+
+    /**
+     * @brief Get the time slice granted to a process on its next dispatch
+     * 
+     * MLFQ doubles the quantum at every level below the top one and FAIR
+     * hands out the process's weighted share of the scheduling period.
+     * SJF and SRTF run one time slice at a time and keep the core between
+     * slices (see holds_core()), SJF until the burst ends and SRTF until a
+     * preemption check fails. All other algorithms use the configured
+     * time slice.
+     * 
+     * @param process Process about to run
+     * @return uint64_t Time slice in milliseconds
+     */
+    uint64_t get_time_slice(const Process* process) const;
+
+    /**
+     * @brief Get the slice granted when no other process is waiting
+     * @return uint64_t Time slice in milliseconds
+     */
+    uint64_t get_uncontended_time_slice() const noexcept;
+
+    /**
+     * @brief Check whether the algorithm preempts running processes
+     * 
+     * Under a preemptive algorithm a running process keeps its core from
+     * one time slice to the next unless should_preempt() says otherwise,
+     * instead of being re-queued after every slice.
+     * 
+     * @return bool True for SRTF and rate-monotonic
+     */
+    bool is_preemptive() const noexcept;
+
+    /**
+     * @brief Check whether a process keeps its core after using its slice
+     * 
+     * Holds for the preemptive algorithms and for SJF, which runs each
+     * burst to completion one time slice at a time.
+     * 
+     * @return bool True for SJF, SRTF and rate-monotonic
+     */
+    bool holds_core() const noexcept;
+
+    /**
+     * @brief Check whether a running process must yield its core
+     * 
+     * Under SRTF a queued process's remaining time never shrinks while it
+     * waits, so a shorter candidate can only be one that arrived (or woke
+     * up) since the running process was dispatched. Under rate-monotonic
+     * scheduling the candidate must have a shorter period.
+     * 
+     * @param running Process running on the core
+     * @param core Core it runs on
+     * @return bool True if a queued process on that core outranks it
+     */
+    bool should_preempt(const Process* running, size_t core) const;
+
+    /**
+     * @brief Take the CPU from a running process and re-queue it
+     * 
+     * Normally called through HardwareSimulator::preempt_process(), which
+     * charges the timer interrupt and switch-out cost.
+     * 
+     * @param process Running process
+     * @param core Core it was running on
+     * @param overhead Preemption overhead charged in milliseconds
+     */
+    void preempt(Process* process, size_t core, uint64_t overhead);
+
+    /**
+     * @brief Get number of preemptions
+     * @return size_t Running processes displaced by a shorter one
+     */
+    size_t get_preemption_count() const noexcept;
+
+    /**
+     * @brief Get total overhead charged for preemptions
+     * @return uint64_t Overhead in milliseconds
+     */
+    uint64_t get_preemption_overhead() const noexcept;
+
+    /**
+     * @brief Charge CPU time consumed by a process in its last dispatch
+     * 
+     * A dispatch may be charged in several parts, e.g. once per simulation
+     * step. Under MLFQ a process whose charges since it was dispatched add
+     * up to its whole quantum is demoted one level;
+     * under FAIR the runtime advances the process's virtual runtime and
+     * under STRIDE it advances the pass value by stride per millisecond.
+     * 
+     * @param process Process that ran
+     * @param runtime CPU time consumed in milliseconds
+     */
+    void account_runtime(Process* process, uint64_t runtime);
+
+    /**
+     * @brief Mark a running process as blocked on I/O or a lock
+     * 
+     * Ends the process's current CPU burst, feeding the adaptive quantum.
+     * 
+     * @param process Process that blocks
+     */
+    void block_process(Process* process);
+
+    /**
+     * @brief Advance scheduler time and run periodic policy work
+     * @param current_time Current simulation time in milliseconds
+     */
+    void tick(uint64_t current_time);
+
     /**
      * @brief Add process to ready queue
+     * 
+     * Under EDF a real-time process is admitted on its first enqueue only
+     * if its utilization (burst / min(deadline, period)) still fits under
+     * the utilization bound; rejected processes are left untouched.
+     * 
      * @param process Process to add
+     * @return bool False if the process was rejected by admission control
+     */
+    bool add_to_ready_queue(Process* process);
+
+    /**
+     * @brief Add several processes to the ready queues at once
+     * 
+     * Equivalent to calling add_to_ready_queue() for each process in order,
+     * but each core's queue is built once per batch (large batches are
+     * heapified in O(n)) and the events are recorded as one batch.
+     * 
+     * @param processes First process
+     * @param count Number of processes
+     * @return size_t Number of processes queued (rejected ones are untouched)
      */
-    void add_to_ready_queue(Process* process);
+    size_t add_to_ready_queue(Process* const* processes, size_t count);
 
     /**
-     * @brief Get next process to execute
-     * @return Process* Process to execute, nullptr if queue empty
+     * @brief Get next process to execute on a core
+     * 
+     * A core whose own queue is empty steals the best candidate of the
+     * busiest core.
+     * 
+     * @param core Core asking for work
+     * @return Process* Process to execute, nullptr if no work anywhere
      */
-    Process* get_next_process();
+    Process* get_next_process(size_t core = 0);
+
+    /**
+     * @brief Dispatch one process to each of several cores at once
+     * 
+     * Slot i belongs to core i. Slots that already hold a process (for
+     * example a gang member from schedule_gangs()) are left alone. Every
+     * empty slot first takes from its own core's queue, and only then do
+     * still-empty slots steal. The dispatch events are recorded as one batch.
+     * 
+     * @param n Number of slots (at most the core count)
+     * @param out Per-core slots, filled with the dispatched processes
+     * @return size_t Number of processes dispatched
+     */
+    size_t get_next_processes(size_t n, Process** out);
 
     /**
      * @brief Remove process from ready queue
@@ -78,6 +492,13 @@ public:
      */
     bool remove_from_ready_queue(Process* process);
 
+    /**
+     * @brief Restore ready queue order after a queued process changed its key
+     * @param process Queued process whose priority or remaining time changed
+     * @return bool True if process was in queue
+     */
+    bool update_ready_process(Process* process);
+
     /**
      * @brief Check if ready queue is empty
      * @return bool True if empty
@@ -86,29 +507,57 @@ public:
 
     /**
      * @brief Get ready queue size
-     * @return size_t Number of processes in queue
+     * @return size_t Number of processes queued on all cores
      */
     size_t get_ready_queue_size() const;
 
+    /**
+     * @brief Get ready queue size of one core
+     * @param core Core index
+     * @return size_t Number of processes queued on the core
+     */
+    size_t get_ready_queue_size(size_t core) const;
+
     /**
      * @brief Clear ready queue
      */
     void clear_ready_queue();
 
+    /**
+     * @brief Get the compile-time selected event recorder
+     * @return const SchedulerRecorder& Recorder (transition counts)
+     */
+    const SchedulerRecorder& get_recorder() const noexcept { return recorder_; }
+
+#if OSRO_SCHEDULER_RECORDER == OSRO_RECORDER_FULL
     /**
      * @brief Get scheduling history
-     * @return const std::vector<ScheduleEvent>& Scheduling events
+     * @return const ScheduleHistory& Most recent scheduling events
+     */
+    const ScheduleHistory& get_schedule_history() const;
+
+    /**
+     * @brief Get scheduling history for configuration (capacity, spilling)
+     * @return ScheduleHistory& Scheduling history
      */
-    const std::vector<ScheduleEvent>& get_schedule_history() const;
+    ScheduleHistory& get_schedule_history();
+#endif
 
     /**
      * @brief Perform context switch simulation
+     * 
+     * The overhead is the cache model's cost of running the incoming
+     * process on the core: cheapest when it left the core moments ago,
+     * most expensive after a migration or a long absence.
+     * 
      * @param from Process switching from (can be nullptr)
      * @param to Process switching to (can be nullptr)
      * @param timestamp Current timestamp
+     * @param core Core the switch happens on
      * @return uint64_t Context switch overhead in milliseconds
      */
-    uint64_t simulate_context_switch(Process* from, Process* to, uint64_t timestamp);
+    uint64_t simulate_context_switch(Process* from, Process* to, uint64_t timestamp,
+                                     size_t core = 0);
 
     /**
      * @brief Get total context switches
@@ -116,6 +565,96 @@ public:
      */
     size_t get_context_switch_count() const noexcept;
 
+    /**
+     * @brief Get number of processes that completed after their deadline
+     * @return size_t Deadline misses
+     */
+    size_t get_deadline_miss_count() const noexcept;
+
+    /**
+     * @brief Get number of processes EDF admission control turned away
+     * 
+     * A rejected process is offered again on later steps; it counts once
+     * however many of those retries fail.
+     * 
+     * @return size_t Admission rejections
+     */
+    size_t get_admission_rejection_count() const noexcept;
+
+    /**
+     * @brief Get total utilization of admitted real-time processes
+     * @return double Admitted utilization
+     */
+    double get_edf_utilization() const noexcept;
+
+    /**
+     * @brief Get ready-queue waiting statistics of a priority level
+     * @param priority Priority level
+     * @return const WaitStats& Waiting statistics
+     */
+    const WaitStats& get_wait_stats(ProcessPriority priority) const noexcept;
+
+    /**
+     * @brief Get the latency SLO of a priority level and its attainment
+     * @param priority Priority level
+     * @return const SloStats& SLO statistics, target 0 if none is set
+     */
+    const SloStats& get_slo_stats(ProcessPriority priority) const noexcept;
+
+    /**
+     * @brief Get statistics of one core
+     * @param core Core index
+     * @return const CoreStats& Core statistics
+     */
+    const CoreStats& get_core_stats(size_t core) const;
+
+    /**
+     * @brief Get fraction of elapsed time a core spent running processes
+     * @param core Core index
+     * @return double Utilization between 0 and 1
+     */
+    double get_core_utilization(size_t core) const;
+
+    /**
+     * @brief Get total number of cross-core migrations
+     * @return size_t Migrations
+     */
+    size_t get_migration_count() const noexcept;
+
+    /**
+     * @brief Capture the scheduler and the scheduling state of its processes
+     * 
+     * Covers configuration, counters, statistics, policy clocks and the
+     * contents of every ready structure, plus the context of every process
+     * in the table. The schedule history, semaphore counts and device wait
+     * queues are not captured, so snapshot while no process holds or waits
+     * for a lock and none is blocked on I/O.
+     * 
+     * @param processes Process table whose processes this scheduler queues
+     * @return SchedulerSnapshot Snapshot that shares nothing with the live state
+     * @throws std::runtime_error If CPU groups hold the ready processes or a lock is in use
+     */
+    SchedulerSnapshot snapshot(const ProcessManager& processes) const;
+
+    /**
+     * @brief Return the scheduler and its processes to a snapshot
+     * 
+     * Ready structures are emptied without terminating anyone, lock state
+     * is dropped, every captured process context is restored and the
+     * queues are rebuilt in their captured order, so the run continues
+     * exactly as it would have from the capture. Processes created after
+     * the capture are left as they are. Processes still waiting on a
+     * device must be released from it first. Nothing changes if the
+     * restore throws.
+     * 
+     * @param snapshot Snapshot to restore
+     * @param processes Process table holding the captured PIDs
+     * @throws std::invalid_argument If a captured PID is missing from the table
+     * @throws std::runtime_error If the snapshot is empty, is FAIR while CPU groups are attached
+     *         or a captured process is queued outside the scheduler
+     */
+    void restore(const SchedulerSnapshot& snapshot, const ProcessManager& processes);
+
     /**
      * @brief Reset scheduler state
      */
@@ -125,40 +664,238 @@ private:
     SchedulingAlgorithm algorithm_;
     uint64_t time_slice_;
     size_t context_switches_;
-    
-    std::queue<Process*> ready_queue_;
-    std::vector<ScheduleEvent> schedule_history_;
+    uint64_t current_time_;
+    uint64_t mlfq_boost_interval_;
+    uint64_t last_boost_time_;
+    uint64_t target_latency_;
+    uint64_t min_granularity_;
+    double edf_utilization_;
+    double edf_utilization_bound_;
+    size_t deadline_misses_;
+    size_t admission_rejections_;
+    uint64_t priority_aging_interval_;
+    std::array<WaitStats, 4> wait_stats_;
+    std::array<SloStats, 4> slo_stats_;
+    std::array<P2Quantile, 4> slo_sketches_;
+    double adaptive_target_;
+    uint64_t adaptive_min_quantum_;
+    uint64_t adaptive_max_quantum_;
+    P2Quantile burst_sketch_;
+    uint64_t load_balance_interval_;
+    uint64_t last_balance_time_;
+    size_t migrations_;
+    size_t preemptions_;
+    uint64_t preemption_overhead_;
+    CacheModel cache_model_;
     
     /**
-     * @brief Compare processes for priority scheduling
+     * @brief Ready members of one process group
      */
-    struct PriorityComparator {
-        bool operator()(const Process* a, const Process* b) const {
-            return *a < *b; // Higher priority first
-        }
+    struct GangQueue {
+        ProcessList ready;
+        bool listed = false; // Present in gang_order_
     };
     
+    const ProcessManager* gang_source_;
+    std::unordered_map<uint32_t, GangQueue> gangs_;
+    std::deque<uint32_t> gang_order_;
+    size_t gang_ready_count_;
+    GangStats gang_stats_;
+    
+    CpuController* cpu_controller_;
+    
+    LockProtocol lock_protocol_;
+    LockManager lock_manager_;
+    
+    std::vector<std::unique_ptr<RunQueue>> run_queues_;
+    std::vector<CoreStats> core_stats_;
+    std::vector<uint64_t> slice_runtime_;  // CPU time charged since each core's last dispatch
+    std::unordered_map<const Process*, double> admitted_utilization_;
+    std::unordered_set<const Process*> rejected_;  // Failed admission, not yet admitted
+    SchedulerRecorder recorder_;
+    
     /**
-     * @brief Compare processes for SJF scheduling
+     * @brief Compute the priority-queue key of a ready process
+     * @param process Process with its ready time set
+     * @return uint64_t Aged priority key, 0 when aging is off
      */
-    struct SJFComparator {
-        bool operator()(const Process* a, const Process* b) const {
-            return a->get_remaining_time() > b->get_remaining_time(); // Shorter job first
-        }
-    };
+    uint64_t aging_key(const Process* process) const noexcept;
+    
+    /**
+     * @brief Pick the core a runnable process should be queued on
+     * @param process Process becoming runnable
+     * @param pending Per-core processes chosen but not yet queued (may be null)
+     * @return size_t Least loaded allowed core, or the cache-warm last core
+     *                when it is at most one process busier
+     */
+    size_t select_core(const Process* process, const size_t* pending = nullptr) const;
+    
+    /**
+     * @brief Check whether a process may run on a core
+     * @param process Process to check
+     * @param core Core index
+     * @return bool True if its affinity allows the core, or excludes every core
+     */
+    bool may_run_on(const Process* process, size_t core) const;
+    
+    /**
+     * @brief Check whether a process is held by the gang scheduler
+     * @param process Process to check
+     * @return bool True if grouped and its group fits on the cores
+     */
+    bool is_gang_member(const Process* process) const;
+    
+    /**
+     * @brief Assign every ready member of a gang to a distinct free core
+     * @param gang Gang to place
+     * @param slots Per-core assignment, updated on success
+     * @return bool False (with slots untouched) if the gang does not fit
+     */
+    bool place_gang(const GangQueue& gang, std::vector<Process*>& slots) const;
+    
+    /**
+     * @brief Check whether a queued process is held by this scheduler
+     * @param process Process to check
+     * @return bool True if a ready structure or lock wait queue holds it
+     */
+    bool holds(const Process* process) const;
+    
+    /**
+     * @brief Prepare a process for queueing (admission, state, aging key)
+     * @param process Process becoming runnable
+     * @return bool False if rejected by admission control
+     */
+    bool make_ready(Process* process);
+    
+    /**
+     * @brief Queue a ready gang member on its group's queue
+     * @param process Gang member
+     */
+    void enqueue_gang(Process* process);
+    
+    /**
+     * @brief Take a process from another core for an idle one
+     * @param core Idle core
+     * @return Process* Stolen process, nullptr if nothing can move
+     */
+    Process* steal(size_t core);
+    
+    /**
+     * @brief Take the CPU group hierarchy's next process for a core
+     * @param core Core asking for work
+     * @return Process* Next process if it may run on the core, else nullptr
+     */
+    Process* take_grouped(size_t core);
+    
+    /**
+     * @brief Queue processes again after the queueing structure changed
+     * @param displaced Processes removed from a structure no longer in use
+     */
+    void requeue(std::vector<Process*> displaced);
+    
+    /**
+     * @brief Update accounting for a process about to run (no event)
+     * @param process Process leaving a ready queue
+     * @param core Core it runs on
+     */
+    void mark_dispatched(Process* process, size_t core);
+    
+    /**
+     * @brief Account a dispatch against its level's SLO and reweight the level
+     * @param cls Priority class index
+     * @param wait Ready-queue wait of the dispatch in milliseconds
+     */
+    void record_slo_wait(size_t cls, uint64_t wait);
+    
+    /**
+     * @brief Push a level's urgency scale to every core's SLO queue
+     * @param cls Priority class index
+     */
+    void apply_slo_scale(size_t cls);
+    
+    /**
+     * @brief Mark a process as running on a core
+     * @param process Process leaving a ready queue
+     * @param core Core it runs on
+     */
+    void dispatch(Process* process, size_t core);
+    
+    /**
+     * @brief Queue a process on a core, applying policy placement
+     * @param process Process to queue
+     * @param core Target core
+     */
+    void enqueue(Process* process, size_t core);
+    
+    /**
+     * @brief Queue a batch of processes on one core
+     * @param processes Processes to queue
+     * @param core Core whose run queue receives them
+     */
+    void enqueue_batch(const std::vector<Process*>& processes, size_t core);
+    
+    /**
+     * @brief Remove the cheapest process to move from one core to another
+     * 
+     * Considers a bounded number of candidates allowed on the destination
+     * and picks the one whose cache on the source is coldest.
+     * 
+     * @param from Source core
+     * @param to Destination core
+     * @return Process* Detached process, nullptr if none may move
+     */
+    Process* detach_migratable(size_t from, size_t to);
+    
+    /**
+     * @brief Move one process from one core's run queue to another's
+     * @param from Source core
+     * @param to Destination core
+     * @return Process* Moved process, nullptr if none may move
+     */
+    Process* migrate_one(size_t from, size_t to);
+    
+    /**
+     * @brief Even out run queue lengths across cores
+     */
+    void balance_load();
+    
+    /**
+     * @brief Get effective fair scheduling period
+     * @return uint64_t Target latency in milliseconds
+     */
+    uint64_t get_target_latency() const noexcept;
+    
+    /**
+     * @brief Get effective minimum fair slice
+     * @return uint64_t Minimum granularity in milliseconds
+     */
+    uint64_t get_min_granularity() const noexcept;
+    
+    /**
+     * @brief Place a process relative to a fair queue's min vruntime
+     * @param process Process becoming runnable
+     * @param queue Fair queue the process joins
+     */
+    void place_fair(Process* process, const FairQueue& queue) const;
+    
+    /**
+     * @brief Run the EDF utilization admission test
+     * @param process Process being enqueued
+     * @return bool True if admitted (or already admitted, or best effort)
+     */
+    bool admit(const Process* process);
     
     /**
-     * @brief Get priority queue for current algorithm
-     * @return std::priority_queue<Process*, std::vector<Process*>, Comparator>&
+     * @brief Return an admitted process's utilization to the pool
+     * @param process Process leaving the system
      */
-    template<typename Comparator>
-    std::priority_queue<Process*, std::vector<Process*>, Comparator>& 
-    get_priority_queue();
+    void release_admission(const Process* process);
     
     /**
-     * @brief Convert queue to priority queue for algorithm change
+     * @brief Close a process's CPU burst and update the burst estimates
+     * @param process Process whose burst ended
      */
-    void convert_to_priority_queue();
+    void end_burst(Process* process);
     
     /**
      * @brief Record scheduling event
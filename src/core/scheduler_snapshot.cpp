@@ -0,0 +1,258 @@
+#include "scheduler_snapshot.h"
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace osro {
+
+namespace {
+
+constexpr char kMagic[8] = {'O', 'S', 'R', 'O', 'S', 'N', 'A', 'P'};
+constexpr uint32_t kVersion = 3;
+
+// Elements reserved up front when reading a vector, so a corrupt length
+// fails on the truncated read rather than on a huge allocation
+constexpr uint64_t kReserveLimit = 4096;
+
+template<typename T>
+void write(std::ostream& out, const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Checkpoint fields must be trivially copyable");
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+T read(std::istream& in) {
+    static_assert(std::is_trivially_copyable<T>::value, "Checkpoint fields must be trivially copyable");
+    T value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!in) {
+        throw std::runtime_error("Scheduler checkpoint is truncated");
+    }
+    return value;
+}
+
+template<typename T>
+void write_vector(std::ostream& out, const std::vector<T>& values) {
+    write<uint64_t>(out, values.size());
+    for (const T& value : values) {
+        write(out, value);
+    }
+}
+
+template<typename T>
+std::vector<T> read_vector(std::istream& in) {
+    uint64_t size = read<uint64_t>(in);
+    std::vector<T> values;
+    values.reserve(static_cast<size_t>(std::min(size, kReserveLimit)));
+    for (uint64_t i = 0; i < size; ++i) {
+        values.push_back(read<T>(in));
+    }
+    return values;
+}
+
+// Generators have no fixed layout, but stream their state as text
+void write_generator(std::ostream& out, const std::mt19937_64& generator) {
+    std::ostringstream text;
+    text << generator;
+    std::string state = text.str();
+    write<uint64_t>(out, state.size());
+    out.write(state.data(), static_cast<std::streamsize>(state.size()));
+}
+
+std::mt19937_64 read_generator(std::istream& in) {
+    uint64_t size = read<uint64_t>(in);
+    std::string state;
+    for (uint64_t i = 0; i < size; ++i) {
+        state.push_back(read<char>(in));
+    }
+    
+    std::mt19937_64 generator;
+    std::istringstream text(state);
+    text >> generator;
+    if (!text) {
+        throw std::runtime_error("Scheduler checkpoint holds a malformed generator state");
+    }
+    return generator;
+}
+
+} // namespace
+
+SchedulerSnapshot::SchedulerSnapshot(SchedulerState state)
+    : state_(std::make_shared<const SchedulerState>(std::move(state))) {}
+
+const SchedulerState& SchedulerSnapshot::get_state() const {
+    if (!state_) {
+        throw std::runtime_error("Snapshot is empty");
+    }
+    return *state_;
+}
+
+void SchedulerSnapshot::serialize(std::ostream& out) const {
+    const SchedulerState& state = get_state();
+    
+    out.write(kMagic, sizeof(kMagic));
+    write(out, kVersion);
+    
+    write(out, state.algorithm);
+    write(out, state.time_slice);
+    write(out, state.mlfq_levels);
+    write(out, state.mlfq_boost_interval);
+    write(out, state.target_latency);
+    write(out, state.min_granularity);
+    write(out, state.edf_utilization_bound);
+    write(out, state.priority_aging_interval);
+    write(out, state.adaptive_target);
+    write(out, state.adaptive_min_quantum);
+    write(out, state.adaptive_max_quantum);
+    write(out, state.load_balance_interval);
+    write(out, state.cache_model);
+    write(out, state.lock_protocol);
+    
+    write(out, state.current_time);
+    write(out, state.last_boost_time);
+    write(out, state.last_balance_time);
+    write(out, state.context_switches);
+    write(out, state.deadline_misses);
+    write(out, state.admission_rejections);
+    write(out, state.migrations);
+    write(out, state.preemptions);
+    write(out, state.preemption_overhead);
+    write(out, state.edf_utilization);
+    write<uint64_t>(out, state.admitted_utilization.size());
+    for (const auto& entry : state.admitted_utilization) {
+        write(out, entry.first);
+        write(out, entry.second);
+    }
+    write_vector(out, state.rejected);
+    write(out, state.wait_stats);
+    write(out, state.slo_stats);
+    write(out, state.slo_sketches);
+    write(out, state.burst_sketch);
+    write(out, state.gang_stats);
+    write_vector(out, state.core_stats);
+    
+    write<uint64_t>(out, state.clocks.size());
+    for (size_t core = 0; core < state.clocks.size(); ++core) {
+        const RunQueueClocks& clocks = state.clocks[core];
+        write(out, clocks.stride_pass);
+        write(out, clocks.min_vruntime);
+        write_generator(out, clocks.lottery_generator);
+        write(out, clocks.lottery_slots);
+        write_vector(out, clocks.lottery_free_slots);
+        write_vector(out, state.run_queues[core]);
+    }
+    write<uint64_t>(out, state.gangs.size());
+    for (const SchedulerState::Gang& gang : state.gangs) {
+        write(out, gang.group);
+        write<uint8_t>(out, gang.listed ? 1 : 0);
+        write_vector(out, gang.ready);
+    }
+    write_vector(out, state.gang_order);
+    write(out, state.gang_ready_count);
+    
+    write_vector(out, state.processes);
+    
+    if (!out) {
+        throw std::runtime_error("Failed to write scheduler checkpoint");
+    }
+}
+
+SchedulerSnapshot SchedulerSnapshot::deserialize(std::istream& in) {
+    char magic[sizeof(kMagic)];
+    in.read(magic, sizeof(magic));
+    if (!in || !std::equal(magic, magic + sizeof(magic), kMagic)) {
+        throw std::runtime_error("Stream is not a scheduler checkpoint");
+    }
+    if (read<uint32_t>(in) != kVersion) {
+        throw std::runtime_error("Unsupported scheduler checkpoint version");
+    }
+    
+    SchedulerState state;
+    state.algorithm = read<SchedulingAlgorithm>(in);
+    state.time_slice = read<uint64_t>(in);
+    state.mlfq_levels = read<size_t>(in);
+    state.mlfq_boost_interval = read<uint64_t>(in);
+    state.target_latency = read<uint64_t>(in);
+    state.min_granularity = read<uint64_t>(in);
+    state.edf_utilization_bound = read<double>(in);
+    state.priority_aging_interval = read<uint64_t>(in);
+    state.adaptive_target = read<double>(in);
+    state.adaptive_min_quantum = read<uint64_t>(in);
+    state.adaptive_max_quantum = read<uint64_t>(in);
+    state.load_balance_interval = read<uint64_t>(in);
+    state.cache_model = read<CacheModel>(in);
+    state.lock_protocol = read<LockProtocol>(in);
+    if (static_cast<int>(state.algorithm) < 0 ||
+        static_cast<int>(state.algorithm) > static_cast<int>(SchedulingAlgorithm::SLO) ||
+        static_cast<int>(state.lock_protocol) < 0 ||
+        static_cast<int>(state.lock_protocol) > static_cast<int>(LockProtocol::PRIORITY_CEILING)) {
+        throw std::runtime_error("Scheduler checkpoint names an unknown policy");
+    }
+    
+    state.current_time = read<uint64_t>(in);
+    state.last_boost_time = read<uint64_t>(in);
+    state.last_balance_time = read<uint64_t>(in);
+    state.context_switches = read<size_t>(in);
+    state.deadline_misses = read<size_t>(in);
+    state.admission_rejections = read<size_t>(in);
+    state.migrations = read<size_t>(in);
+    state.preemptions = read<size_t>(in);
+    state.preemption_overhead = read<uint64_t>(in);
+    state.edf_utilization = read<double>(in);
+    uint64_t admitted = read<uint64_t>(in);
+    for (uint64_t i = 0; i < admitted; ++i) {
+        uint32_t pid = read<uint32_t>(in);
+        state.admitted_utilization.emplace_back(pid, read<double>(in));
+    }
+    state.rejected = read_vector<uint32_t>(in);
+    state.wait_stats = read<std::array<WaitStats, 4>>(in);
+    state.slo_stats = read<std::array<SloStats, 4>>(in);
+    state.slo_sketches = read<std::array<P2Quantile, 4>>(in);
+    state.burst_sketch = read<P2Quantile>(in);
+    state.gang_stats = read<GangStats>(in);
+    state.core_stats = read_vector<CoreStats>(in);
+    
+    uint64_t cores = read<uint64_t>(in);
+    if (cores == 0 || cores > kMaxCores || cores != state.core_stats.size()) {
+        throw std::runtime_error("Scheduler checkpoint has an invalid core count");
+    }
+    for (uint64_t core = 0; core < cores; ++core) {
+        RunQueueClocks clocks;
+        clocks.stride_pass = read<uint64_t>(in);
+        clocks.min_vruntime = read<uint64_t>(in);
+        clocks.lottery_generator = read_generator(in);
+        clocks.lottery_slots = read<size_t>(in);
+        clocks.lottery_free_slots = read_vector<size_t>(in);
+        state.run_queues.push_back(read_vector<uint32_t>(in));
+        
+        // Every slot is either free or held by a queued lottery process
+        size_t holders = state.algorithm == SchedulingAlgorithm::LOTTERY ? state.run_queues.back().size() : 0;
+        std::vector<size_t> free_slots = clocks.lottery_free_slots;
+        std::sort(free_slots.begin(), free_slots.end());
+        if (clocks.lottery_slots != holders + free_slots.size() ||
+            std::adjacent_find(free_slots.begin(), free_slots.end()) != free_slots.end() ||
+            (!free_slots.empty() && free_slots.back() >= clocks.lottery_slots)) {
+            throw std::runtime_error("Scheduler checkpoint has an invalid lottery layout");
+        }
+        state.clocks.push_back(std::move(clocks));
+    }
+    uint64_t gangs = read<uint64_t>(in);
+    for (uint64_t i = 0; i < gangs; ++i) {
+        SchedulerState::Gang gang;
+        gang.group = read<uint32_t>(in);
+        gang.listed = read<uint8_t>(in) != 0;
+        gang.ready = read_vector<uint32_t>(in);
+        state.gangs.push_back(std::move(gang));
+    }
+    state.gang_order = read_vector<uint32_t>(in);
+    state.gang_ready_count = read<size_t>(in);
+    
+    state.processes = read_vector<ProcessContext>(in);
+    return SchedulerSnapshot(std::move(state));
+}
+
+} // namespace osro
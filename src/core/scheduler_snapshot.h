@@ -0,0 +1,142 @@
+#pragma once
+
+#include "process.h"
+#include "cache_model.h"
+#include "lock_manager.h"
+#include "run_queue.h"
+#include "scheduler.h"
+#include "../utils/p2_quantile.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Scheduler and process state needed to resume a simulation
+ *
+ * Processes are referred to by PID, so a state can be restored into the
+ * process table it was taken from or into one rebuilt with the same PIDs.
+ */
+struct SchedulerState {
+    /**
+     * @brief Ready members of one process group
+     */
+    struct Gang {
+        uint32_t group = 0;
+        bool listed = false;          // Present in the gang order
+        std::vector<uint32_t> ready;  // Ready member PIDs in queue order
+    };
+
+    // Configuration
+    SchedulingAlgorithm algorithm = SchedulingAlgorithm::ROUND_ROBIN;
+    uint64_t time_slice = 0;
+    size_t mlfq_levels = 0;
+    uint64_t mlfq_boost_interval = 0;
+    uint64_t target_latency = 0;
+    uint64_t min_granularity = 0;
+    double edf_utilization_bound = 0.0;
+    uint64_t priority_aging_interval = 0;
+    double adaptive_target = 0.0;
+    uint64_t adaptive_min_quantum = 0;
+    uint64_t adaptive_max_quantum = 0;
+    uint64_t load_balance_interval = 0;
+    CacheModel cache_model{0, 0, 0};
+    LockProtocol lock_protocol = LockProtocol::NONE;
+
+    // Clocks and counters
+    uint64_t current_time = 0;
+    uint64_t last_boost_time = 0;
+    uint64_t last_balance_time = 0;
+    size_t context_switches = 0;
+    size_t deadline_misses = 0;
+    size_t admission_rejections = 0;
+    size_t migrations = 0;
+    size_t preemptions = 0;
+    uint64_t preemption_overhead = 0;
+    double edf_utilization = 0.0;
+    std::vector<std::pair<uint32_t, double>> admitted_utilization;  // PID, admitted share
+    std::vector<uint32_t> rejected;  // PIDs that failed admission and are not yet admitted
+    std::array<WaitStats, 4> wait_stats;
+    std::array<SloStats, 4> slo_stats;
+    std::array<P2Quantile, 4> slo_sketches;
+    P2Quantile burst_sketch;
+    GangStats gang_stats;
+    std::vector<CoreStats> core_stats;
+
+    // Ready structures, one entry per core
+    std::vector<RunQueueClocks> clocks;
+    std::vector<std::vector<uint32_t>> run_queues;  // Queued PIDs in structure order
+    std::vector<Gang> gangs;
+    std::vector<uint32_t> gang_order;
+    size_t gang_ready_count = 0;
+
+    // Every process of the table, queued or not
+    std::vector<ProcessContext> processes;
+};
+
+/**
+ * @brief Immutable, cheaply copyable capture of a mid-run scheduler
+ *
+ * Copies share one read-only state, so a snapshot can be forked into
+ * any number of what-if runs for the cost of a reference count; nothing
+ * is duplicated until Scheduler::restore() writes it into the live
+ * queues and processes, which is O(n) in processes rather than a replay
+ * of the whole run.
+ *
+ * serialize() writes a binary image that deserialize() reads back in a
+ * build of the same version; it is a checkpoint format, not an exchange
+ * format.
+ */
+class SchedulerSnapshot {
+public:
+    /**
+     * @brief Construct an empty snapshot
+     */
+    SchedulerSnapshot() = default;
+
+    /**
+     * @brief Wrap a captured state
+     * @param state State to share between copies
+     */
+    explicit SchedulerSnapshot(SchedulerState state);
+
+    bool empty() const noexcept { return !state_; }
+
+    /**
+     * @brief Get the captured state
+     * @return const SchedulerState& State
+     * @throws std::runtime_error If the snapshot is empty
+     */
+    const SchedulerState& get_state() const;
+
+    /**
+     * @brief Get the simulated time of the capture
+     * @return uint64_t Time in milliseconds
+     */
+    uint64_t get_time() const { return get_state().current_time; }
+
+    /**
+     * @brief Write the snapshot as a binary checkpoint
+     * @param out Binary output stream
+     * @throws std::runtime_error If the snapshot is empty or the write fails
+     */
+    void serialize(std::ostream& out) const;
+
+    /**
+     * @brief Read a checkpoint written by serialize()
+     * @param in Binary input stream
+     * @return SchedulerSnapshot Snapshot of the checkpoint
+     * @throws std::runtime_error If the stream is truncated or not a checkpoint
+     */
+    static SchedulerSnapshot deserialize(std::istream& in);
+
+private:
+    std::shared_ptr<const SchedulerState> state_;
+};
+
+} // namespace osro
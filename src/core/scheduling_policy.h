@@ -0,0 +1,211 @@
+#pragma once
+
+#include "process.h"
+#include "process_list.h"
+#include "process_order.h"
+#include "indexed_heap.h"
+#include "multilevel_queue.h"
+#include "lottery_queue.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace osro {
+
+/**
+ * @brief Default hooks of a scheduling policy
+ *
+ * A policy plugged into PolicyScheduler owns its ready queue and provides
+ * push(), pop(), erase(), size() and clear() plus the hooks below. It
+ * inherits from PolicyHooks and hides only the hooks it needs; all calls
+ * are resolved at compile time, so unused hooks cost nothing.
+ */
+struct PolicyHooks {
+    /**
+     * @brief Get the slice granted to a process on dispatch
+     * @param base Configured time slice in milliseconds
+     * @return uint64_t Time slice in milliseconds
+     */
+    uint64_t time_slice(const Process*, uint64_t base) const noexcept { return base; }
+
+    /**
+     * @brief Called before a process is queued
+     */
+    void on_enqueue(Process*, uint64_t) noexcept {}
+
+    /**
+     * @brief Called after a process consumed CPU time
+     *
+     * Receives the run time and the slice the process was granted.
+     */
+    void on_run(Process*, uint64_t, uint64_t) noexcept {}
+
+    /**
+     * @brief Called when scheduler time advances
+     */
+    void on_tick(uint64_t) noexcept {}
+};
+
+/**
+ * @brief Policy whose ready queue is an IndexedHeap ordered by Compare
+ * @tparam Compare Strict weak ordering; Compare(a, b) is true when a runs first
+ */
+template<typename Compare>
+class HeapPolicy : public PolicyHooks {
+public:
+    void push(Process* process) { heap_.push(process); }
+    Process* pop() { return heap_.pop(); }
+    bool erase(Process* process) { return heap_.erase(process); }
+    size_t size() const noexcept { return heap_.size(); }
+    void clear() noexcept { heap_.clear(); }
+
+protected:
+    IndexedHeap<Compare> heap_;
+};
+
+/**
+ * @brief FIFO time slicing
+ */
+class RoundRobinPolicy : public PolicyHooks {
+public:
+    static constexpr const char* kName = "RR";
+
+    void push(Process* process) noexcept { queue_.push_back(process); }
+    Process* pop() noexcept { return queue_.pop_front(); }
+    bool erase(Process* process) noexcept { return queue_.erase(process); }
+    size_t size() const noexcept { return queue_.size(); }
+    void clear() noexcept { queue_.clear(); }
+
+private:
+    ProcessList queue_;
+};
+
+/**
+ * @brief Highest priority first, aged as in Scheduler::set_priority_aging
+ */
+class PriorityPolicy : public HeapPolicy<PriorityOrder> {
+public:
+    static constexpr const char* kName = "Priority";
+
+    /**
+     * @brief Configure priority aging
+     * @param interval Wait per priority level in milliseconds (0 = strict priority)
+     */
+    void set_aging_interval(uint64_t interval) noexcept { aging_interval_ = interval; }
+
+    void on_enqueue(Process* process, uint64_t now) noexcept {
+        process->set_ready_time(now);
+        process->set_aging_key(get_aging_key(now, process->get_priority(), aging_interval_));
+    }
+
+private:
+    uint64_t aging_interval_ = 0;
+};
+
+/**
+ * @brief Shortest remaining time first, run to completion
+ */
+class ShortestJobPolicy : public HeapPolicy<RemainingTimeOrder> {
+public:
+    static constexpr const char* kName = "SJF";
+
+    uint64_t time_slice(const Process* process, uint64_t) const noexcept {
+        return process->get_remaining_time();
+    }
+};
+
+/**
+ * @brief Earliest absolute deadline first (no admission control)
+ */
+class DeadlinePolicy : public HeapPolicy<DeadlineOrder> {
+public:
+    static constexpr const char* kName = "EDF";
+};
+
+/**
+ * @brief Lowest pass value first; pass advances by stride per millisecond
+ */
+class StridePolicy : public HeapPolicy<PassOrder> {
+public:
+    static constexpr const char* kName = "Stride";
+
+    Process* pop() {
+        Process* process = heap_.pop();
+        if (process) {
+            global_pass_ = std::max(global_pass_, process->get_pass());
+        }
+        return process;
+    }
+
+    void clear() noexcept {
+        heap_.clear();
+        global_pass_ = 0;
+    }
+
+    // Joining processes start at the global pass instead of jumping ahead
+    void on_enqueue(Process* process, uint64_t) noexcept {
+        process->set_pass(std::max(process->get_pass(), global_pass_));
+    }
+
+    void on_run(Process* process, uint64_t runtime, uint64_t) noexcept {
+        process->set_pass(process->get_pass() + LotteryQueue::get_stride(process->get_priority()) * runtime);
+    }
+
+private:
+    uint64_t global_pass_ = 0;
+};
+
+/**
+ * @brief Multilevel feedback queue with quantum doubling and periodic boost
+ */
+class MlfqPolicy : public PolicyHooks {
+public:
+    static constexpr const char* kName = "MLFQ";
+
+    void push(Process* process) { queue_.push(process); }
+    Process* pop() { return queue_.pop(); }
+    bool erase(Process* process) { return queue_.erase(process); }
+    size_t size() const noexcept { return queue_.size(); }
+
+    void clear() {
+        queue_.release();
+        last_boost_ = 0;
+    }
+
+    /**
+     * @brief Configure levels and boost (queue must be empty)
+     * @param levels Number of priority levels (1 to MultilevelQueue::kMaxLevels)
+     * @param boost_interval Time between priority boosts in milliseconds (0 disables)
+     */
+    void set_parameters(size_t levels, uint64_t boost_interval) {
+        queue_.set_level_count(levels);
+        boost_interval_ = boost_interval;
+    }
+
+    uint64_t time_slice(const Process* process, uint64_t base) const noexcept {
+        return MultilevelQueue::get_time_slice(base, process->get_queue_level());
+    }
+
+    // Demote processes that used their whole quantum
+    void on_run(Process* process, uint64_t runtime, uint64_t slice) noexcept {
+        uint32_t level = process->get_queue_level();
+        if (runtime >= slice && level + 1 < queue_.get_level_count()) {
+            process->set_queue_level(level + 1);
+        }
+    }
+
+    // Periodic boost keeps demoted processes from starving
+    void on_tick(uint64_t now) {
+        if (boost_interval_ > 0 && now - last_boost_ >= boost_interval_) {
+            queue_.boost();
+            last_boost_ = now;
+        }
+    }
+
+private:
+    MultilevelQueue queue_;
+    uint64_t boost_interval_ = MultilevelQueue::kDefaultBoostInterval;
+    uint64_t last_boost_ = 0;
+};
+
+} // namespace osro
@@ -0,0 +1,177 @@
+#include "segregated_free_list.h"
+#include "../utils/bit_ops.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace osro {
+
+SegregatedFreeList::SegregatedFreeList()
+    : class_map_(0),
+      free_bytes_(0),
+      size_(0) {
+    bin_maps_.fill(0);
+}
+
+size_t SegregatedFreeList::get_bin(uint64_t size) noexcept {
+    // Sizes below one full set of sub-bins map linearly into class 0
+    if (size < kSubBins) {
+        return static_cast<size_t>(size);
+    }
+
+    unsigned msb = find_last_set(size);
+    size_t cls = msb - kSubBinBits + 1;
+    size_t sub = static_cast<size_t>(size >> (msb - kSubBinBits)) & (kSubBins - 1);
+    return cls * kSubBins + sub;
+}
+
+void SegregatedFreeList::insert(uint64_t address, uint64_t size) {
+    if (size == 0) {
+        throw std::invalid_argument("Free block size must be greater than 0");
+    }
+
+    size_t bin = get_bin(size);
+    Bin& entry = bins_[bin];
+    if (!entry.by_address.emplace(address, size).second) {
+        throw std::invalid_argument("Free block is already indexed");
+    }
+    entry.by_size.emplace(size, address);
+
+    size_t cls = bin / kSubBins;
+    bin_maps_[cls] |= (uint64_t{1} << (bin % kSubBins));
+    class_map_ |= (uint64_t{1} << cls);
+    free_bytes_ += size;
+    ++size_;
+}
+
+bool SegregatedFreeList::erase(uint64_t address, uint64_t size) {
+    if (size == 0) {
+        return false;
+    }
+
+    size_t bin = get_bin(size);
+    Bin& entry = bins_[bin];
+    auto it = entry.by_address.find(address);
+    if (it == entry.by_address.end() || it->second != size) {
+        return false;
+    }
+
+    entry.by_address.erase(it);
+    entry.by_size.erase({size, address});
+    if (entry.by_address.empty()) {
+        size_t cls = bin / kSubBins;
+        bin_maps_[cls] &= ~(uint64_t{1} << (bin % kSubBins));
+        if (bin_maps_[cls] == 0) {
+            class_map_ &= ~(uint64_t{1} << cls);
+        }
+    }
+    free_bytes_ -= size;
+    --size_;
+    return true;
+}
+
+uint64_t SegregatedFreeList::find_first_fit(uint64_t size) const {
+    if (size == 0) {
+        size = 1;
+    }
+
+    // Every block in a higher bin fits, so only each bin's lowest address matters
+    size_t own = get_bin(size);
+    uint64_t first = kNotFound;
+    for (size_t bin = find_occupied(own + 1); bin < kBins; bin = find_occupied(bin + 1)) {
+        first = std::min(first, bins_[bin].by_address.begin()->first);
+    }
+
+    // Blocks in the request's own bin may be too small; only those below
+    // the best candidate so far can win
+    for (const auto& block : bins_[own].by_address) {
+        if (block.first >= first) {
+            break;
+        }
+        if (block.second >= size) {
+            return block.first;
+        }
+    }
+    return first;
+}
+
+uint64_t SegregatedFreeList::find_best_fit(uint64_t size) const {
+    if (size == 0) {
+        size = 1;
+    }
+
+    size_t own = get_bin(size);
+    const auto& candidates = bins_[own].by_size;
+    auto it = candidates.lower_bound({size, 0});
+    if (it != candidates.end()) {
+        return it->second;
+    }
+
+    size_t bin = find_occupied(own + 1);
+    return bin < kBins ? bins_[bin].by_size.begin()->second : kNotFound;
+}
+
+uint64_t SegregatedFreeList::find_worst_fit(uint64_t size) const {
+    size_t bin = find_last_occupied();
+    if (bin == kBins) {
+        return kNotFound;
+    }
+
+    const auto& candidates = bins_[bin].by_size;
+    uint64_t largest = std::prev(candidates.end())->first;
+    if (largest < size) {
+        return kNotFound;
+    }
+    return candidates.lower_bound({largest, 0})->second;
+}
+
+uint64_t SegregatedFreeList::get_largest() const {
+    size_t bin = find_last_occupied();
+    return bin < kBins ? std::prev(bins_[bin].by_size.end())->first : 0;
+}
+
+void SegregatedFreeList::clear() {
+    for (size_t cls = 0; cls < kClasses; ++cls) {
+        for (uint64_t subs = bin_maps_[cls]; subs != 0; subs &= subs - 1) {
+            Bin& entry = bins_[cls * kSubBins + find_first_set(subs)];
+            entry.by_size.clear();
+            entry.by_address.clear();
+        }
+    }
+
+    bin_maps_.fill(0);
+    class_map_ = 0;
+    free_bytes_ = 0;
+    size_ = 0;
+}
+
+size_t SegregatedFreeList::find_occupied(size_t bin) const noexcept {
+    if (bin >= kBins) {
+        return kBins;
+    }
+
+    size_t cls = bin / kSubBins;
+    uint64_t subs = bin_maps_[cls] & (~uint64_t{0} << (bin % kSubBins));
+    if (subs != 0) {
+        return cls * kSubBins + find_first_set(subs);
+    }
+
+    // kClasses is below 64, so the shift is always defined
+    uint64_t classes = class_map_ & (~uint64_t{0} << (cls + 1));
+    if (classes == 0) {
+        return kBins;
+    }
+    cls = find_first_set(classes);
+    return cls * kSubBins + find_first_set(bin_maps_[cls]);
+}
+
+size_t SegregatedFreeList::find_last_occupied() const noexcept {
+    if (class_map_ == 0) {
+        return kBins;
+    }
+
+    size_t cls = find_last_set(class_map_);
+    return cls * kSubBins + find_last_set(bin_maps_[cls]);
+}
+
+} // namespace osro
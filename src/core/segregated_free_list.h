@@ -0,0 +1,123 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+
+namespace osro {
+
+/**
+ * @brief Size-class segregated index of free memory blocks
+ *
+ * Free blocks are binned TLSF-style: each power-of-two size class is
+ * split into kSubBins linear sub-bins, and a two-level occupancy bitmap
+ * records which bins hold blocks. Finding the first non-empty bin that
+ * can satisfy a request is two find-first-set operations, so lookups no
+ * longer walk every block in the system.
+ *
+ * Each bin keeps its blocks ordered by (size, address) and by address,
+ * which lets the lookups reproduce the linear-scan strategies exactly:
+ * best fit and worst fit are O(log n), and first fit visits one entry
+ * per occupied bin above the request plus the low-address blocks of
+ * the request's own bin.
+ */
+class SegregatedFreeList {
+public:
+    static constexpr unsigned kSubBinBits = 3;
+    static constexpr size_t kSubBins = size_t{1} << kSubBinBits;
+    static constexpr size_t kClasses = 64 - kSubBinBits + 1;
+    static constexpr size_t kBins = kClasses * kSubBins;
+
+    /// Returned by lookups when no free block is large enough
+    static constexpr uint64_t kNotFound = UINT64_MAX;
+
+    SegregatedFreeList();
+
+    /**
+     * @brief Map a block size to its bin
+     * @param size Block size in bytes (must be greater than 0)
+     * @return size_t Bin index, ordered by size
+     */
+    static size_t get_bin(uint64_t size) noexcept;
+
+    /**
+     * @brief Add a free block
+     * @param address Starting address
+     * @param size Block size in bytes (must be greater than 0)
+     */
+    void insert(uint64_t address, uint64_t size);
+
+    /**
+     * @brief Remove a free block
+     * @param address Starting address
+     * @param size Block size the block was inserted with
+     * @return bool True if the block was indexed
+     */
+    bool erase(uint64_t address, uint64_t size);
+
+    /**
+     * @brief Find the lowest-addressed block that fits
+     * @param size Required size
+     * @return uint64_t Block address, kNotFound if none fits
+     */
+    uint64_t find_first_fit(uint64_t size) const;
+
+    /**
+     * @brief Find the smallest block that fits, lowest address on ties
+     * @param size Required size
+     * @return uint64_t Block address, kNotFound if none fits
+     */
+    uint64_t find_best_fit(uint64_t size) const;
+
+    /**
+     * @brief Find the largest block if it fits, lowest address on ties
+     * @param size Required size
+     * @return uint64_t Block address, kNotFound if none fits
+     */
+    uint64_t find_worst_fit(uint64_t size) const;
+
+    /**
+     * @brief Get the size of the largest free block
+     * @return uint64_t Size in bytes, 0 if there are no free blocks
+     */
+    uint64_t get_largest() const;
+
+    /**
+     * @brief Remove every block
+     */
+    void clear();
+
+    uint64_t get_free_bytes() const noexcept { return free_bytes_; }
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+private:
+    struct Bin {
+        std::set<std::pair<uint64_t, uint64_t>> by_size;  // (size, address)
+        std::map<uint64_t, uint64_t> by_address;          // address -> size
+    };
+
+    /**
+     * @brief Find the first occupied bin at or above a bin
+     * @param bin Lowest bin to consider
+     * @return size_t Bin index, kBins if all higher bins are empty
+     */
+    size_t find_occupied(size_t bin) const noexcept;
+
+    /**
+     * @brief Find the highest occupied bin
+     * @return size_t Bin index, kBins if empty
+     */
+    size_t find_last_occupied() const noexcept;
+
+    std::array<Bin, kBins> bins_;
+    uint64_t class_map_;                       // Bit c set while class c has blocks
+    std::array<uint64_t, kClasses> bin_maps_;  // Bit s set while sub-bin s has blocks
+    uint64_t free_bytes_;
+    size_t size_;
+};
+
+} // namespace osro
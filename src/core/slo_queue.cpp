@@ -0,0 +1,135 @@
+#include "slo_queue.h"
+#include <stdexcept>
+
+namespace osro {
+
+SloQueue::SloQueue()
+    : size_(0) {
+    scales_.fill(kDefaultScale);
+}
+
+size_t SloQueue::get_class(ProcessPriority priority) noexcept {
+    switch (priority) {
+        case ProcessPriority::LOW:
+            return 0;
+        case ProcessPriority::MEDIUM:
+            return 1;
+        case ProcessPriority::HIGH:
+            return 2;
+        case ProcessPriority::CRITICAL:
+            return 3;
+    }
+    return 0;
+}
+
+void SloQueue::set_scale(size_t cls, double scale) {
+    if (cls >= kClasses) {
+        throw std::out_of_range("SLO class index out of range");
+    }
+    if (!(scale > 0.0)) {
+        throw std::invalid_argument("SLO urgency scale must be greater than 0");
+    }
+    scales_[cls] = scale;
+}
+
+void SloQueue::push(Process* process) {
+    classes_[get_class(process->get_priority())].push_back(process);
+    ++size_;
+}
+
+Process* SloQueue::pop(uint64_t now) {
+    size_t cls = select(now);
+    if (cls == kClasses) {
+        return nullptr;
+    }
+    
+    --size_;
+    return classes_[cls].pop_front();
+}
+
+const Process* SloQueue::top(uint64_t now) const {
+    size_t cls = select(now);
+    return cls != kClasses ? classes_[cls].front() : nullptr;
+}
+
+bool SloQueue::erase(Process* process) {
+    ProcessList* list = find(process);
+    if (!list) {
+        return false;
+    }
+    
+    list->erase(process);
+    --size_;
+    return true;
+}
+
+bool SloQueue::update(Process* process) {
+    ProcessList* list = find(process);
+    if (!list) {
+        return false;
+    }
+    
+    ProcessList& target = classes_[get_class(process->get_priority())];
+    if (list != &target) {
+        list->erase(process);
+        target.push_back(process);
+    }
+    return true;
+}
+
+bool SloQueue::contains(const Process* process) const noexcept {
+    for (const ProcessList& list : classes_) {
+        if (list.contains(process)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<Process*> SloQueue::release() {
+    std::vector<Process*> released;
+    released.reserve(size_);
+    
+    for (size_t cls = kClasses; cls-- > 0;) {
+        while (Process* process = classes_[cls].pop_front()) {
+            released.push_back(process);
+        }
+    }
+    
+    size_ = 0;
+    return released;
+}
+
+ProcessList* SloQueue::find(const Process* process) noexcept {
+    // The queue hook names the owning list, so each check is O(1)
+    for (ProcessList& list : classes_) {
+        if (list.contains(process)) {
+            return &list;
+        }
+    }
+    return nullptr;
+}
+
+size_t SloQueue::select(uint64_t now) const noexcept {
+    size_t best = kClasses;
+    double best_urgency = 0.0;
+    
+    // Highest class first, so it wins ties
+    for (size_t cls = kClasses; cls-- > 0;) {
+        const Process* head = classes_[cls].front();
+        if (!head) {
+            continue;
+        }
+        
+        // Count the current millisecond so fresh arrivals still compare by scale
+        uint64_t wait = now > head->get_ready_time() ? now - head->get_ready_time() : 0;
+        double urgency = static_cast<double>(wait + 1) * scales_[cls];
+        if (best == kClasses || urgency > best_urgency) {
+            best = cls;
+            best_urgency = urgency;
+        }
+    }
+    return best;
+}
+
+} // namespace osro
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "process.h"
+#include "process_list.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Per-class FIFO queues for latency-SLO scheduling
+ *
+ * Processes wait in one FIFO list per priority class, so the head of a
+ * class is its longest waiter. pop() serves the class whose head has
+ * the highest urgency, its wait so far times the class scale. The
+ * scheduler derives the scales from each class's latency target and
+ * how its tail latency is tracking, so classes trade off dynamically
+ * rather than in a fixed priority order. Selection looks at one head
+ * per class and is O(1).
+ */
+class SloQueue {
+public:
+    static constexpr size_t kClasses = 4;
+
+    /// Urgency per ms of waiting for classes without an SLO (a 1 s target)
+    static constexpr double kDefaultScale = 0.001;
+
+    SloQueue();
+
+    /**
+     * @brief Map a priority to its class index
+     * @param priority Priority level
+     * @return size_t Class index, 0 for LOW up to 3 for CRITICAL
+     */
+    static size_t get_class(ProcessPriority priority) noexcept;
+
+    /**
+     * @brief Set how fast a class's urgency grows with waiting time
+     * @param cls Class index
+     * @param scale Urgency per ms of head wait (must be positive)
+     */
+    void set_scale(size_t cls, double scale);
+
+    double get_scale(size_t cls) const { return scales_.at(cls); }
+
+    /**
+     * @brief Enqueue a process at the tail of its priority class
+     * @param process Process to enqueue
+     */
+    void push(Process* process);
+
+    /**
+     * @brief Dequeue the head of the most urgent class
+     * @param now Current time
+     * @return Process* Dequeued process, nullptr if empty
+     */
+    Process* pop(uint64_t now);
+
+    /**
+     * @brief Get the process pop() would return at a given time
+     * @param now Current time
+     * @return const Process* Next process, nullptr if empty
+     */
+    const Process* top(uint64_t now) const;
+
+    /**
+     * @brief Remove a queued process
+     * @param process Process to remove
+     * @return bool True if the process was queued here
+     */
+    bool erase(Process* process);
+
+    /**
+     * @brief Move a queued process whose priority changed to its new class
+     *
+     * The process joins the tail of the new class.
+     *
+     * @param process Process to move
+     * @return bool True if the process was queued here
+     */
+    bool update(Process* process);
+
+    /**
+     * @brief Check whether a process is queued here
+     * @param process Process to look up
+     * @return bool True if queued
+     */
+    bool contains(const Process* process) const noexcept;
+
+    /**
+     * @brief Remove all processes, highest class first
+     * @return std::vector<Process*> Previously queued processes
+     */
+    std::vector<Process*> release();
+
+    /**
+     * @brief Visit every process, highest class first
+     * @param visit Callable taking Process*
+     */
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const {
+        for (size_t cls = kClasses; cls-- > 0;) {
+            classes_[cls].for_each(visit);
+        }
+    }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+private:
+    std::array<ProcessList, kClasses> classes_;
+    std::array<double, kClasses> scales_;
+    size_t size_;
+
+    /**
+     * @brief Find the list holding a process
+     * @param process Process to look up
+     * @return ProcessList* Its class list, nullptr if not queued here
+     */
+    ProcessList* find(const Process* process) noexcept;
+
+    /**
+     * @brief Pick the most urgent non-empty class
+     * @param now Current time
+     * @return size_t Class index, kClasses if empty
+     */
+    size_t select(uint64_t now) const noexcept;
+};
+
+} // namespace osro
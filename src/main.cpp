@@ -3,6 +3,10 @@
 #include "core/memory_manager.h"
 #include "core/analytics.h"
 #include "core/hardware_simulator.h"
+#include "core/parallel_executor.h"
+#include "core/policy_scheduler.h"
+#include "core/response_time_analysis.h"
+#include "core/scheduler_snapshot.h"
 #include "utils/random_generator.h"
 #include "utils/timer.h"
 #include <iostream>
@@ -13,6 +17,8 @@
 #include <sstream>
 #include <algorithm>
 #include <cstddef>
+#include <utility>
+#include <unordered_map>
 
 namespace osro {
 
@@ -54,6 +60,78 @@ public:
      */
     void run_memory_benchmark(size_t num_processes, uint64_t total_memory);
 
+    /**
+     * @brief Time allocation and free churn against a heavily fragmented free space
+     * @param fragments Number of free fragments to create
+     * @param allocations Allocations and free/reallocate pairs timed per strategy
+     */
+    void run_fragmentation_benchmark(size_t fragments, size_t allocations);
+
+    /**
+     * @brief Compare independent and gang scheduling of process groups
+     * @param num_processes Number of processes
+     * @param total_memory Total memory
+     * @param gang_size Processes per group
+     */
+    void run_gang_benchmark(size_t num_processes, uint64_t total_memory, size_t gang_size);
+
+    /**
+     * @brief Run the fair scheduler with tenants capped by CPU group quotas
+     * @param num_processes Number of processes
+     * @param total_memory Total memory
+     */
+    void run_tenant_benchmark(size_t num_processes, uint64_t total_memory);
+
+    /**
+     * @brief Run a single-core workload through statically dispatched policies
+     * @param num_processes Number of processes
+     * @param total_memory Total memory
+     * @param simulation_time Simulation duration in milliseconds
+     */
+    void run_policy_benchmark(size_t num_processes, uint64_t total_memory,
+                              uint64_t simulation_time);
+
+    /**
+     * @brief Check periodic task sets with response-time analysis, then
+     *        simulate the feasible ones under rate-monotonic scheduling
+     * @param simulation_time Simulation duration in milliseconds
+     */
+    void run_rate_monotonic_benchmark(uint64_t simulation_time);
+
+    /**
+     * @brief Reproduce priority inversion on a mutex under each lock protocol
+     * @param waiter_count Processes piled onto one mutex for the contention test
+     */
+    void run_lock_benchmark(size_t waiter_count);
+
+    /**
+     * @brief Compare per-priority p99 wait SLO attainment of strict
+     *        priority and the SLO policy on one workload
+     * @param num_processes Number of processes
+     * @param total_memory Total memory
+     */
+    void run_slo_benchmark(size_t num_processes, uint64_t total_memory);
+
+    /**
+     * @brief Fork one mid-run snapshot into several candidate policies
+     *        instead of re-simulating each from the start
+     * @param num_processes Number of processes
+     * @param total_memory Total memory
+     */
+    void run_what_if_benchmark(size_t num_processes, uint64_t total_memory);
+
+    /**
+     * @brief Run simulation with every simulated core on its own host thread
+     * @param num_processes Number of processes
+     * @param total_memory Total memory
+     * @param simulation_time Simulation duration in milliseconds
+     * @param host_threads Number of simulated cores / host threads
+     * @param epoch_length Simulated milliseconds between core synchronizations
+     */
+    void run_parallel_simulation(size_t num_processes, uint64_t total_memory,
+                                 uint64_t simulation_time, size_t host_threads,
+                                 uint64_t epoch_length);
+
     /**
      * @brief Generate final performance report
      * @return std::string Comprehensive performance analysis
@@ -88,16 +166,25 @@ private:
      */
     void create_test_processes(size_t num_processes, uint64_t total_memory);
     
+    /**
+     * @brief Recreate the same seeded workload on a clean scheduler and memory
+     * @param num_processes Number of processes to create
+     * @param total_memory Total available memory
+     */
+    void reset_workload(size_t num_processes, uint64_t total_memory);
+    
     /**
      * @brief Run single simulation iteration
      * @param algorithm Scheduling algorithm to use
      * @param strategy Memory allocation strategy
      * @param simulation_time Simulation duration
+     * @param start_time Time to resume from, e.g. that of a restored snapshot
      * @return PerformanceMetrics Simulation results
      */
     PerformanceMetrics run_simulation_iteration(SchedulingAlgorithm algorithm,
                                               AllocationStrategy strategy,
-                                              uint64_t simulation_time);
+                                              uint64_t simulation_time,
+                                              uint64_t start_time = 0);
     
     /**
      * @brief Process simulation events
@@ -136,6 +223,7 @@ void OSSimulator::initialize_components() {
     process_manager_ = std::make_unique<ProcessManager>();
     memory_manager_ = std::make_unique<MemoryManager>(1024 * 1024 * 1024); // 1GB
     scheduler_ = std::make_unique<Scheduler>(SchedulingAlgorithm::ROUND_ROBIN);
+    scheduler_->set_core_count(4);
     analytics_ = std::make_unique<ResourceAnalytics>(*process_manager_, *scheduler_, *memory_manager_);
     hardware_simulator_ = std::make_unique<HardwareSimulator>(*scheduler_, *memory_manager_);
     random_gen_ = std::make_unique<RandomGenerator>(42);
@@ -162,7 +250,13 @@ void OSSimulator::run_comprehensive_simulation(size_t num_processes,
     std::vector<SchedulingAlgorithm> algorithms = {
         SchedulingAlgorithm::ROUND_ROBIN,
         SchedulingAlgorithm::PRIORITY,
-        SchedulingAlgorithm::SHORTEST_JOB_FIRST
+        SchedulingAlgorithm::SHORTEST_JOB_FIRST,
+        SchedulingAlgorithm::SRTF,
+        SchedulingAlgorithm::MLFQ,
+        SchedulingAlgorithm::FAIR,
+        SchedulingAlgorithm::EDF,
+        SchedulingAlgorithm::LOTTERY,
+        SchedulingAlgorithm::STRIDE
     };
     
     std::vector<AllocationStrategy> strategies = {
@@ -173,8 +267,7 @@ void OSSimulator::run_comprehensive_simulation(size_t num_processes,
     
     for (const auto& algorithm : algorithms) {
         for (const auto& strategy : strategies) {
-            std::cout << "Testing: " << (algorithm == SchedulingAlgorithm::ROUND_ROBIN ? "RR" : 
-                                        algorithm == SchedulingAlgorithm::PRIORITY ? "Priority" : "SJF")
+            std::cout << "Testing: " << to_string(algorithm)
                       << " + " << (strategy == AllocationStrategy::FIRST_FIT ? "First Fit" :
                                   strategy == AllocationStrategy::BEST_FIT ? "Best Fit" : "Worst Fit") << "\n";
             
@@ -192,24 +285,51 @@ void OSSimulator::run_comprehensive_simulation(size_t num_processes,
 void OSSimulator::run_algorithm_comparison(size_t num_processes, uint64_t total_memory) {
     std::cout << "=== Algorithm Comparison Benchmark ===\n";
     
-    create_test_processes(num_processes, total_memory);
-    
     std::vector<SchedulingAlgorithm> algorithms = {
         SchedulingAlgorithm::ROUND_ROBIN,
         SchedulingAlgorithm::PRIORITY,
-        SchedulingAlgorithm::SHORTEST_JOB_FIRST
+        SchedulingAlgorithm::SHORTEST_JOB_FIRST,
+        SchedulingAlgorithm::SRTF,
+        SchedulingAlgorithm::MLFQ,
+        SchedulingAlgorithm::FAIR,
+        SchedulingAlgorithm::EDF,
+        SchedulingAlgorithm::LOTTERY,
+        SchedulingAlgorithm::STRIDE
     };
     
     for (const auto& algorithm : algorithms) {
+        // Each algorithm runs the identical workload from the start
+        reset_workload(num_processes, total_memory);
         scheduler_->set_algorithm(algorithm);
         auto metrics = run_simulation_iteration(algorithm, AllocationStrategy::BEST_FIT, 5000);
         
-        std::cout << algorithm << " Results:\n";
+        std::cout << to_string(algorithm) << " Results:\n";
         std::cout << "  Throughput: " << metrics.throughput << " processes/sec\n";
         std::cout << "  Avg Turnaround: " << metrics.average_turnaround_time << "ms\n";
         std::cout << "  Avg Waiting: " << metrics.average_waiting_time << "ms\n";
-        std::cout << "  Context Switches: " << metrics.context_switches << "\n\n";
+        std::cout << "  Context Switches: " << metrics.context_switches << "\n";
+        if (metrics.preemptions > 0) {
+            std::cout << "  Preemptions: " << metrics.preemptions << " ("
+                      << metrics.preemption_overhead << "ms overhead)\n";
+        }
+        std::cout << "  I/O Completions: " << hardware_simulator_->get_io_completion_count()
+                  << " (" << hardware_simulator_->get_waiting_count() << " still waiting)\n";
+        std::cout << "\n";
     }
+    
+    // Round Robin again, sizing the quantum so 80% of bursts fit one slice
+    reset_workload(num_processes, total_memory);
+    scheduler_->set_algorithm(SchedulingAlgorithm::ROUND_ROBIN);
+    scheduler_->set_adaptive_quantum(0.8);
+    auto metrics = run_simulation_iteration(SchedulingAlgorithm::ROUND_ROBIN, AllocationStrategy::BEST_FIT, 5000);
+    
+    std::cout << "RR (adaptive quantum) Results:\n";
+    std::cout << "  Throughput: " << metrics.throughput << " processes/sec\n";
+    std::cout << "  Avg Turnaround: " << metrics.average_turnaround_time << "ms\n";
+    std::cout << "  Avg Waiting: " << metrics.average_waiting_time << "ms\n";
+    std::cout << "  Context Switches: " << metrics.context_switches << "\n";
+    std::cout << "  Learned Quantum: " << scheduler_->get_adaptive_quantum() << "ms\n\n";
+    scheduler_->set_adaptive_quantum(0.0);
 }
 
 void OSSimulator::run_memory_benchmark(size_t num_processes, uint64_t total_memory) {
@@ -235,6 +355,630 @@ void OSSimulator::run_memory_benchmark(size_t num_processes, uint64_t total_memo
     }
 }
 
+void OSSimulator::run_fragmentation_benchmark(size_t fragments, size_t allocations) {
+    std::cout << "=== Fragmented Allocation Benchmark ===\n";
+    
+    const uint64_t page_size = 4096;
+    const uint64_t max_pages = 8;
+    const uint32_t hole_owner = 1;
+    const uint32_t pinned_owner = 2;
+    const uint32_t first_request_owner = 3;
+    
+    std::vector<AllocationStrategy> strategies = {
+        AllocationStrategy::FIRST_FIT,
+        AllocationStrategy::BEST_FIT,
+        AllocationStrategy::WORST_FIT
+    };
+    
+    for (const auto& strategy : strategies) {
+        // Holes of 1 to max_pages pages between pinned pages (the first one
+        // keeps address 0, which reads as failure, out of reach); requests
+        // are sized like the holes, so most of them land inside one
+        MemoryManager memory((max_pages + 1) * page_size * (fragments + allocations), page_size, strategy);
+        random_gen_->set_seed(11);
+        for (size_t i = 0; i < fragments; ++i) {
+            memory.allocate(pinned_owner, page_size);
+            memory.allocate(hole_owner, random_gen_->generate_memory_requirement(1, max_pages) * page_size);
+        }
+        memory.allocate(pinned_owner, page_size);
+        memory.deallocate_all(hole_owner);
+        
+        // One owner per request, like short-lived processes
+        std::vector<uint64_t> addresses(allocations);
+        size_t satisfied = 0;
+        simulation_timer_->start();
+        for (size_t i = 0; i < allocations; ++i) {
+            uint64_t size = random_gen_->generate_memory_requirement(1, max_pages) * page_size;
+            addresses[i] = memory.allocate(first_request_owner + static_cast<uint32_t>(i), size);
+            satisfied += addresses[i] != 0 ? 1 : 0;
+        }
+        simulation_timer_->stop();
+        uint64_t elapsed = simulation_timer_->get_elapsed_microseconds();
+        
+        // Churn: free a random request, then allocate a replacement
+        simulation_timer_->start();
+        for (size_t i = 0; i < allocations; ++i) {
+            size_t victim = static_cast<size_t>(random_gen_->generate_memory_requirement(0, allocations - 1));
+            uint32_t owner = first_request_owner + static_cast<uint32_t>(victim);
+            memory.deallocate(owner, addresses[victim]);
+            uint64_t size = random_gen_->generate_memory_requirement(1, max_pages) * page_size;
+            addresses[victim] = memory.allocate(owner, size);
+        }
+        simulation_timer_->stop();
+        uint64_t churn_elapsed = simulation_timer_->get_elapsed_microseconds();
+        
+        std::cout << (strategy == AllocationStrategy::FIRST_FIT ? "First Fit" :
+                      strategy == AllocationStrategy::BEST_FIT ? "Best Fit" : "Worst Fit") << " Results:\n";
+        std::cout << "  Free Fragments: " << fragments << "\n";
+        std::cout << "  Allocations: " << satisfied << "/" << allocations << " in " << elapsed << "us ("
+                  << std::fixed << std::setprecision(1)
+                  << static_cast<double>(elapsed) * 1000.0 / static_cast<double>(allocations) << "ns each)\n";
+        std::cout << "  Free + Reallocate: " << allocations << " in " << churn_elapsed << "us ("
+                  << static_cast<double>(churn_elapsed) * 1000.0 / static_cast<double>(allocations) << "ns each)\n";
+        std::cout << "  Fragmentation: " << (memory.get_fragmentation() * 100) << "%\n\n";
+    }
+}
+
+void OSSimulator::run_gang_benchmark(size_t num_processes, uint64_t total_memory, size_t gang_size) {
+    std::cout << "=== Gang Scheduling Benchmark ===\n";
+    
+    for (bool gang_scheduling : {false, true}) {
+        // Terminate leftovers while their processes still exist
+        scheduler_->reset();
+        create_test_processes(num_processes, total_memory);
+        
+        // Group processes that arrive close together, like the ranks of one job
+        auto members = process_manager_->get_processes_by_state(ProcessState::NEW);
+        std::sort(members.begin(), members.end(), [](const Process* a, const Process* b) {
+            return a->get_arrival_time() < b->get_arrival_time();
+        });
+        uint32_t group_id = 0;
+        for (size_t i = 0; i < members.size(); ++i) {
+            if (i % gang_size == 0) {
+                group_id = process_manager_->create_group();
+            }
+            process_manager_->add_to_group(group_id, members[i]->get_pid());
+        }
+        
+        scheduler_->set_gang_scheduling(gang_scheduling ? process_manager_.get() : nullptr);
+        auto metrics = run_simulation_iteration(SchedulingAlgorithm::ROUND_ROBIN,
+                                                AllocationStrategy::BEST_FIT, 5000);
+        
+        std::cout << (gang_scheduling ? "Gang" : "Independent") << " Results:\n";
+        std::cout << "  Throughput: " << metrics.throughput << " processes/sec\n";
+        std::cout << "  Avg Turnaround: " << metrics.average_turnaround_time << "ms\n";
+        std::cout << "  Idle Core Waste: " << (metrics.idle_core_waste * 100) << "%\n";
+        std::cout << "  Gang Fragmentation: " << (metrics.gang_fragmentation * 100) << "%\n\n";
+    }
+    
+    scheduler_->set_gang_scheduling(nullptr);
+}
+
+void OSSimulator::run_tenant_benchmark(size_t num_processes, uint64_t total_memory) {
+    std::cout << "=== Multi-Tenant CPU Group Benchmark ===\n";
+    
+    reset_workload(num_processes, total_memory);
+    
+    // Tenant A gets twice B's share; B is capped at one core's worth per period
+    // and splits its share between a batch and an interactive service
+    CpuController groups;
+    uint32_t tenant_a = groups.create_group(CpuController::kRootGroup, 2 * CpuController::kDefaultWeight);
+    uint32_t tenant_b = groups.create_group(CpuController::kRootGroup, CpuController::kDefaultWeight);
+    groups.set_quota(tenant_b, CpuController::kDefaultPeriod, CpuController::kDefaultPeriod);
+    uint32_t batch = groups.create_group(tenant_b, CpuController::kDefaultWeight);
+    uint32_t interactive = groups.create_group(tenant_b, 3 * CpuController::kDefaultWeight);
+    
+    const uint32_t leaves[] = {tenant_a, batch, interactive};
+    const auto& processes = process_manager_->get_all_processes();
+    for (size_t i = 0; i < processes.size(); ++i) {
+        groups.attach(processes[i], leaves[i % 3]);
+    }
+    
+    scheduler_->set_cpu_controller(&groups);
+    auto metrics = run_simulation_iteration(SchedulingAlgorithm::FAIR, AllocationStrategy::BEST_FIT, 5000);
+    
+    std::cout << "  Throughput: " << metrics.throughput << " processes/sec\n";
+    std::cout << "  Quota Exhaustions: " << metrics.quota_exhaustions << "\n";
+    std::cout << "  Throttled Time: " << metrics.throttled_time << "ms\n";
+    const std::pair<const char*, uint32_t> reported[] = {
+        {"Tenant A", tenant_a}, {"Tenant B", tenant_b},
+        {"  B/batch", batch}, {"  B/interactive", interactive}
+    };
+    for (const auto& entry : reported) {
+        CpuGroupStats stats = groups.get_stats(entry.second);
+        std::cout << "  " << entry.first << ": " << stats.usage << "ms CPU, "
+                  << stats.throttled_time << "ms throttled\n";
+    }
+    std::cout << "\n";
+    
+    // Queued processes go back to the per-core queues before the groups go away
+    scheduler_->set_cpu_controller(nullptr);
+}
+
+void OSSimulator::run_policy_benchmark(size_t num_processes, uint64_t total_memory,
+                                       uint64_t simulation_time) {
+    std::cout << "=== Static Policy Benchmark ===\n";
+    
+    std::vector<SchedulingAlgorithm> algorithms = {
+        SchedulingAlgorithm::ROUND_ROBIN,
+        SchedulingAlgorithm::PRIORITY,
+        SchedulingAlgorithm::SHORTEST_JOB_FIRST,
+        SchedulingAlgorithm::MLFQ,
+        SchedulingAlgorithm::EDF,
+        SchedulingAlgorithm::STRIDE
+    };
+    
+    for (const auto& algorithm : algorithms) {
+        reset_workload(num_processes, total_memory);
+        
+        // Chosen at run time; every call below lands in fully inlined policy code
+        AnyPolicyScheduler scheduler = make_policy_scheduler(algorithm, scheduler_->get_time_slice(nullptr));
+        
+        auto pending = process_manager_->get_processes_by_state(ProcessState::NEW);
+        std::sort(pending.begin(), pending.end(), [](const Process* a, const Process* b) {
+            return a->get_arrival_time() < b->get_arrival_time();
+        });
+        size_t next_arrival = 0;
+        
+        analytics_->set_time_bounds(0, simulation_time);
+        simulation_timer_->start();
+        
+        uint64_t current_time = 0;
+        while (current_time < simulation_time) {
+            scheduler.tick(current_time);
+            while (next_arrival < pending.size() &&
+                   pending[next_arrival]->get_arrival_time() <= current_time) {
+                scheduler.add_to_ready_queue(pending[next_arrival++]);
+            }
+            
+            Process* process = scheduler.get_next_process();
+            if (!process) {
+                // Idle until the next arrival
+                if (next_arrival == pending.size()) {
+                    break;
+                }
+                current_time = pending[next_arrival]->get_arrival_time();
+                continue;
+            }
+            
+            uint64_t slice = scheduler.get_time_slice(process);
+            uint64_t runtime = std::min(slice, process->get_remaining_time());
+            bool completed = process->execute(slice);
+            scheduler.account_runtime(process, runtime);
+            current_time += std::max<uint64_t>(runtime, 1);
+            
+            if (completed) {
+                process->set_state(ProcessState::TERMINATED);
+                process->set_completion_time(current_time);
+                memory_manager_->deallocate_all(process->get_pid());
+            } else {
+                scheduler.add_to_ready_queue(process);
+            }
+        }
+        
+        simulation_timer_->stop();
+        auto metrics = analytics_->calculate_metrics();
+        
+        std::cout << scheduler.get_name() << " Results:\n";
+        std::cout << "  Throughput: " << metrics.throughput << " processes/sec\n";
+        std::cout << "  Avg Turnaround: " << metrics.average_turnaround_time << "ms\n";
+        std::cout << "  Dispatches: " << scheduler.get_dispatch_count() << "\n";
+        std::cout << "  Host Time: " << simulation_timer_->get_elapsed_microseconds() << "us\n\n";
+    }
+}
+
+void OSSimulator::run_rate_monotonic_benchmark(uint64_t simulation_time) {
+    std::cout << "=== Rate-Monotonic Schedulability Benchmark ===\n";
+    
+    // Control loops {WCET, period}; at 100% scale the load is about 84%,
+    // above the Liu and Layland bound, so only the exact test can admit it
+    const std::pair<uint64_t, uint64_t> loops[] = {
+        {3, 20}, {4, 25}, {5, 40}, {6, 50}, {8, 80}, {7, 100}, {12, 200}, {20, 400}
+    };
+    
+    scheduler_->reset();
+    scheduler_->set_core_count(1);
+    for (uint64_t scale : {100, 140}) {
+        scheduler_->reset();
+        memory_manager_->reset();
+        process_manager_->reset();
+        for (const auto& loop : loops) {
+            Process* process = process_manager_->create_process(0, loop.first * scale / 100, 4096,
+                                                                ProcessPriority::MEDIUM);
+            process->set_period(loop.second);
+        }
+        
+        ResponseTimeAnalysis analysis(ResponseTimeAnalysis::collect(process_manager_->get_all_processes()));
+        std::cout << "WCET x" << scale << "%: utilization " << (analysis.get_utilization() * 100)
+                  << "% (LL bound " << (analysis.get_utilization_bound() * 100) << "%)\n";
+        
+        // Infeasible configurations never reach the simulator
+        if (!analysis.is_schedulable()) {
+            for (const TaskResponse& task : analysis.get_tasks()) {
+                if (!task.schedulable) {
+                    std::cout << "  Rejected: PID " << task.id << " response >= "
+                              << task.response_time << "ms, deadline " << task.deadline << "ms\n";
+                    break;
+                }
+            }
+            std::cout << "\n";
+            continue;
+        }
+        
+        scheduler_->set_algorithm(SchedulingAlgorithm::RATE_MONOTONIC);
+        const auto& processes = process_manager_->get_all_processes();
+        Process* running = nullptr;
+        for (uint64_t current_time = 0; current_time < simulation_time; ++current_time) {
+            scheduler_->tick(current_time);
+            for (Process* process : processes) {
+                if (process->get_state() == ProcessState::NEW &&
+                    process->get_arrival_time() <= current_time) {
+                    scheduler_->add_to_ready_queue(process);
+                }
+            }
+            
+            if (running && scheduler_->should_preempt(running, 0)) {
+                scheduler_->preempt(running, 0, 0);
+                running = nullptr;
+            }
+            if (!running) {
+                running = scheduler_->get_next_process(0);
+                if (!running) {
+                    continue;
+                }
+            }
+            
+            bool completed = running->execute(1);
+            scheduler_->account_runtime(running, 1);
+            if (completed) {
+                analysis.observe(running->get_pid(), current_time + 1 - running->get_arrival_time());
+                running->start_next_job();
+                running = nullptr;
+            }
+        }
+        
+        for (const TaskResponse& task : analysis.get_tasks()) {
+            std::cout << "  PID " << task.id << ": predicted " << task.response_time
+                      << "ms, observed " << task.observed << "ms, deadline " << task.deadline << "ms\n";
+        }
+        std::cout << "  Prediction Violations: " << analysis.get_violation_count() << "\n";
+        std::cout << "  Deadline Misses: " << scheduler_->get_deadline_miss_count() << "\n";
+        std::cout << "  Preemptions: " << scheduler_->get_preemption_count() << "\n\n";
+    }
+    
+    // Offline analysis cost for a large synthetic set at about 70% load
+    std::vector<PeriodicTask> tasks(10000);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        tasks[i].id = static_cast<uint32_t>(i + 1);
+        tasks[i].period = random_gen_->generate_burst_time(100000, 10000000);
+        tasks[i].wcet = std::max<uint64_t>(1, tasks[i].period * 7 / 100000);
+    }
+    simulation_timer_->start();
+    ResponseTimeAnalysis large(std::move(tasks));
+    simulation_timer_->stop();
+    std::cout << "10000-task analysis: " << (large.is_schedulable() ? "schedulable" : "unschedulable")
+              << ", " << large.get_iterations() << " iterations, "
+              << simulation_timer_->get_elapsed_microseconds() << "us\n\n";
+    
+    scheduler_->reset();
+    scheduler_->set_algorithm(SchedulingAlgorithm::ROUND_ROBIN);
+    scheduler_->set_core_count(4);
+}
+
+void OSSimulator::run_lock_benchmark(size_t waiter_count) {
+    std::cout << "=== Priority Inversion Benchmark ===\n";
+    
+    scheduler_->reset();
+    scheduler_->set_core_count(1);
+    scheduler_->set_algorithm(SchedulingAlgorithm::PRIORITY);
+    LockManager& locks = scheduler_->get_lock_manager();
+    uint32_t mutex = locks.create_mutex(ProcessPriority::CRITICAL);
+    
+    for (LockProtocol protocol : {LockProtocol::NONE, LockProtocol::PRIORITY_INHERITANCE,
+                                  LockProtocol::PRIORITY_CEILING}) {
+        scheduler_->reset();
+        hardware_simulator_->reset();
+        memory_manager_->reset();
+        process_manager_->reset();
+        scheduler_->set_lock_protocol(protocol);
+        
+        // A LOW process takes the mutex, a CRITICAL one needs it shortly after,
+        // and MEDIUM processes that never touch it compete for the only core
+        Process* low = process_manager_->create_process(0, 60, 4096, ProcessPriority::LOW);
+        Process* critical = process_manager_->create_process(5, 10, 4096, ProcessPriority::CRITICAL);
+        for (int i = 0; i < 4; ++i) {
+            process_manager_->create_process(8, 150, 4096, ProcessPriority::MEDIUM);
+        }
+        
+        // Critical sections as {lock, unlock} offsets in executed milliseconds
+        std::unordered_map<const Process*, std::pair<uint64_t, uint64_t>> sections = {
+            {low, {0, 30}}, {critical, {0, 5}}
+        };
+        auto executed = [](const Process* process) {
+            return process->get_burst_time() - process->get_remaining_time();
+        };
+        auto wants_lock = [&](const Process* process) {
+            auto section = sections.find(process);
+            return section != sections.end() && executed(process) == section->second.first &&
+                   locks.get_owner(mutex) != process;
+        };
+        
+        const auto& processes = process_manager_->get_all_processes();
+        Process* running = nullptr;
+        uint64_t slice_used = 0;
+        for (uint64_t current_time = 0; process_manager_->get_completed_count() < processes.size();
+             ++current_time) {
+            scheduler_->tick(current_time);
+            for (Process* process : processes) {
+                if (process->get_state() == ProcessState::NEW &&
+                    process->get_arrival_time() <= current_time) {
+                    scheduler_->add_to_ready_queue(process);
+                }
+            }
+            
+            // A process that blocks on the mutex hands the core straight back
+            for (;;) {
+                if (!running) {
+                    running = scheduler_->get_next_process(0);
+                    slice_used = 0;
+                }
+                if (!running || !wants_lock(running)) {
+                    break;
+                }
+                hardware_simulator_->simulate_system_call(running, SyncOperation::MUTEX_LOCK, mutex, current_time);
+                if (running->get_state() != ProcessState::BLOCKED) {
+                    break;
+                }
+                running = nullptr;
+            }
+            if (!running) {
+                continue;
+            }
+            
+            bool completed = running->execute(1);
+            scheduler_->account_runtime(running, 1);
+            slice_used++;
+            
+            auto section = sections.find(running);
+            if (section != sections.end() && executed(running) == section->second.second) {
+                hardware_simulator_->simulate_system_call(running, SyncOperation::MUTEX_UNLOCK, mutex,
+                                                          current_time + 1);
+            }
+            
+            if (completed) {
+                running->set_completion_time(current_time + 1);
+                running = nullptr;
+            } else if (slice_used >= scheduler_->get_time_slice(running)) {
+                scheduler_->add_to_ready_queue(running);
+                running = nullptr;
+            }
+        }
+        
+        const LockStats& stats = locks.get_stats();
+        std::cout << to_string(protocol) << " Results:\n";
+        std::cout << "  CRITICAL Turnaround: " << critical->get_turnaround_time() << "ms\n";
+        std::cout << "  Priority Inversion: " << stats.inversion_time << "ms (longest "
+                  << stats.max_inversion_time << "ms)\n";
+        std::cout << "  LOW Turnaround: " << low->get_turnaround_time() << "ms\n\n";
+    }
+    
+    // Contention at scale: every process queues on one mutex, then each
+    // unlock hands it to the most urgent remaining waiter
+    scheduler_->reset();
+    hardware_simulator_->reset();
+    process_manager_->reset();
+    scheduler_->set_lock_protocol(LockProtocol::PRIORITY_INHERITANCE);
+    
+    std::vector<Process*> contenders;
+    contenders.reserve(waiter_count);
+    for (size_t i = 0; i < waiter_count; ++i) {
+        contenders.push_back(process_manager_->create_process(0, 10, 4096, random_gen_->generate_priority()));
+    }
+    
+    simulation_timer_->start();
+    for (size_t i = 0; i < contenders.size(); ++i) {
+        locks.lock(contenders[i], mutex, i);
+    }
+    size_t handoffs = 0;
+    size_t out_of_order = 0;
+    ProcessPriority previous = ProcessPriority::CRITICAL;
+    for (Process* owner = contenders.front(); owner; ) {
+        owner = locks.unlock(owner, mutex, waiter_count + handoffs);
+        if (owner) {
+            handoffs++;
+            out_of_order += owner->get_base_priority() > previous ? 1 : 0;
+            previous = owner->get_base_priority();
+        }
+    }
+    simulation_timer_->stop();
+    
+    std::cout << waiter_count << "-waiter contention: " << handoffs << " handoffs, "
+              << out_of_order << " out of priority order, "
+              << simulation_timer_->get_elapsed_microseconds() << "us\n\n";
+    
+    scheduler_->reset();
+    scheduler_->set_lock_protocol(LockProtocol::NONE);
+    scheduler_->set_algorithm(SchedulingAlgorithm::ROUND_ROBIN);
+    scheduler_->set_core_count(4);
+}
+
+void OSSimulator::run_slo_benchmark(size_t num_processes, uint64_t total_memory) {
+    std::cout << "=== Tail-Latency SLO Benchmark ===\n";
+    
+    // p99 ready-queue wait targets; LOW is best effort
+    const std::vector<std::pair<ProcessPriority, uint64_t>> slos = {
+        {ProcessPriority::CRITICAL, 50},
+        {ProcessPriority::HIGH, 200},
+        {ProcessPriority::MEDIUM, 1000}
+    };
+    const char* names[] = {"LOW", "MEDIUM", "HIGH", "CRITICAL"};
+    
+    for (SchedulingAlgorithm algorithm : {SchedulingAlgorithm::PRIORITY, SchedulingAlgorithm::SLO}) {
+        reset_workload(num_processes, total_memory);
+        for (const auto& slo : slos) {
+            scheduler_->set_latency_slo(slo.first, slo.second);
+        }
+        auto metrics = run_simulation_iteration(algorithm, AllocationStrategy::BEST_FIT, 5000);
+        
+        std::cout << "\n" << to_string(algorithm) << " Results (" << metrics.slo_misses << " SLOs missed):\n";
+        size_t level = 0;
+        for (ProcessPriority priority : {ProcessPriority::LOW, ProcessPriority::MEDIUM,
+                                         ProcessPriority::HIGH, ProcessPriority::CRITICAL}) {
+            const SloStats& slo = scheduler_->get_slo_stats(priority);
+            std::cout << "  " << names[level] << ": max wait " << metrics.max_wait_by_priority[level] << "ms";
+            if (slo.target != 0) {
+                std::cout << ", p99 ~" << slo.estimate << "ms (target " << slo.target << "ms), "
+                          << (metrics.slo_attainment_by_priority[level] * 100.0) << "% within target";
+            }
+            std::cout << "\n";
+            level++;
+        }
+    }
+    std::cout << "\n";
+    
+    for (const auto& slo : slos) {
+        scheduler_->set_latency_slo(slo.first, 0);
+    }
+    scheduler_->set_algorithm(SchedulingAlgorithm::ROUND_ROBIN);
+}
+
+void OSSimulator::run_what_if_benchmark(size_t num_processes, uint64_t total_memory) {
+    std::cout << "=== What-If Fork Benchmark ===\n";
+    
+    const uint64_t fork_time = 2500;
+    const uint64_t horizon = 5000;
+    const uint32_t fork_seed = 7;
+    
+    // Simulate up to the decision point once
+    reset_workload(num_processes, total_memory);
+    run_simulation_iteration(SchedulingAlgorithm::PRIORITY, AllocationStrategy::BEST_FIT, fork_time);
+    uint64_t replay_us = simulation_timer_->get_elapsed_microseconds();
+    
+    // Device queues are not part of a snapshot, so let pending I/O finish first
+    hardware_simulator_->complete_all_io(fork_time);
+    SchedulerSnapshot base = scheduler_->snapshot(*process_manager_);
+    
+    // Neither is memory, which every fork frees as its processes complete
+    const MemoryManager base_memory = *memory_manager_;
+    
+    std::stringstream checkpoint(std::ios::in | std::ios::out | std::ios::binary);
+    base.serialize(checkpoint);
+    size_t checkpoint_bytes = checkpoint.str().size();
+    SchedulerSnapshot loaded = SchedulerSnapshot::deserialize(checkpoint);
+    
+    auto resume = [&](const SchedulerSnapshot& snapshot, const MemoryManager& memory,
+                      SchedulingAlgorithm algorithm, uint64_t start_time, uint64_t& restore_us) {
+        simulation_timer_->start();
+        hardware_simulator_->clear_wait_queues();
+        scheduler_->restore(snapshot, *process_manager_);
+        *memory_manager_ = memory;
+        simulation_timer_->stop();
+        restore_us = simulation_timer_->get_elapsed_microseconds();
+        
+        random_gen_->set_seed(fork_seed);
+        return run_simulation_iteration(algorithm, AllocationStrategy::BEST_FIT, horizon, start_time);
+    };
+    
+    std::cout << "\nForked at t=" << base.get_time() << "ms (reaching it took "
+              << replay_us << "us)\n";
+    for (SchedulingAlgorithm algorithm : {SchedulingAlgorithm::PRIORITY, SchedulingAlgorithm::ROUND_ROBIN,
+                                          SchedulingAlgorithm::SHORTEST_JOB_FIRST, SchedulingAlgorithm::MLFQ,
+                                          SchedulingAlgorithm::FAIR, SchedulingAlgorithm::SLO}) {
+        // Each fork shares the captured state until restore copies it in
+        SchedulerSnapshot fork = base;
+        uint64_t restore_us = 0;
+        auto metrics = resume(fork, base_memory, algorithm, fork_time, restore_us);
+        
+        std::cout << "\n" << to_string(algorithm) << " from t=" << fork_time << "ms:\n";
+        std::cout << "  Completed: " << metrics.completed_processes << "/" << metrics.total_processes << "\n";
+        std::cout << "  Context Switches: " << metrics.context_switches << "\n";
+        std::cout << "  Max CRITICAL Wait: " << metrics.max_wait_by_priority[3] << "ms\n";
+        std::cout << "  Restore: " << restore_us << "us\n";
+    }
+    
+    auto identical = [](const PerformanceMetrics& a, const PerformanceMetrics& b) {
+        return a.completed_processes == b.completed_processes &&
+               a.context_switches == b.context_switches &&
+               a.max_wait_by_priority == b.max_wait_by_priority &&
+               a.average_turnaround_time == b.average_turnaround_time;
+    };
+    
+    // A checkpoint read back from its binary image resumes identically
+    uint64_t restore_us = 0;
+    auto original = resume(base, base_memory, SchedulingAlgorithm::FAIR, fork_time, restore_us);
+    auto reloaded = resume(loaded, base_memory, SchedulingAlgorithm::FAIR, fork_time, restore_us);
+    std::cout << "\nCheckpoint: " << checkpoint_bytes << " bytes, resumed run "
+              << (identical(original, reloaded) ? "matches" : "DIFFERS") << "\n";
+    
+    // Lottery draws depend on where holders sit in the ticket tree, so a
+    // run checkpointed mid-LOTTERY must resume with the live run's draws.
+    // Checkpoint while processes still arrive, so arrivals fill the slots
+    // that were free at the checkpoint
+    const uint64_t lottery_fork_time = 500;
+    reset_workload(num_processes, total_memory);
+    run_simulation_iteration(SchedulingAlgorithm::LOTTERY, AllocationStrategy::BEST_FIT, lottery_fork_time);
+    hardware_simulator_->complete_all_io(lottery_fork_time);
+    std::stringstream lottery_checkpoint(std::ios::in | std::ios::out | std::ios::binary);
+    scheduler_->snapshot(*process_manager_).serialize(lottery_checkpoint);
+    const MemoryManager lottery_memory = *memory_manager_;
+    random_gen_->set_seed(fork_seed);
+    auto live = run_simulation_iteration(SchedulingAlgorithm::LOTTERY, AllocationStrategy::BEST_FIT,
+                                         horizon, lottery_fork_time);
+    auto resumed = resume(SchedulerSnapshot::deserialize(lottery_checkpoint), lottery_memory,
+                          SchedulingAlgorithm::LOTTERY, lottery_fork_time, restore_us);
+    std::cout << "\nLottery checkpoint: resumed run "
+              << (identical(live, resumed) ? "matches" : "DIFFERS") << " the live run\n\n";
+    
+    scheduler_->set_algorithm(SchedulingAlgorithm::ROUND_ROBIN);
+}
+
+void OSSimulator::run_parallel_simulation(size_t num_processes, uint64_t total_memory,
+                                          uint64_t simulation_time, size_t host_threads,
+                                          uint64_t epoch_length) {
+    std::cout << "=== Parallel Simulation ===\n";
+    std::cout << "Host Threads: " << host_threads << ", Epoch: " << epoch_length << "ms\n";
+    
+    create_test_processes(num_processes, total_memory);
+    
+    // Admit in arrival order instead of scanning all processes every epoch
+    auto pending = process_manager_->get_processes_by_state(ProcessState::NEW);
+    std::sort(pending.begin(), pending.end(), [](const Process* a, const Process* b) {
+        return a->get_arrival_time() < b->get_arrival_time();
+    });
+    size_t next_arrival = 0;
+    
+    ParallelExecutor executor(host_threads, epoch_length, scheduler_->get_time_slice(nullptr));
+    analytics_->set_time_bounds(0, simulation_time);
+    simulation_timer_->start();
+    
+    executor.run(simulation_time, [&](uint64_t current_time) {
+        while (next_arrival < pending.size() &&
+               pending[next_arrival]->get_arrival_time() <= current_time) {
+            executor.submit(pending[next_arrival++]);
+        }
+        for (Process* process : executor.take_completed()) {
+            memory_manager_->deallocate_all(process->get_pid());
+        }
+    });
+    
+    simulation_timer_->stop();
+    
+    auto metrics = analytics_->calculate_metrics();
+    benchmark_results_.push_back(metrics);
+    
+    std::cout << "  Throughput: " << std::fixed << std::setprecision(2)
+              << metrics.throughput << " processes/sec\n";
+    std::cout << "  Wall Time: " << simulation_timer_->get_elapsed_milliseconds() << "ms\n";
+    for (size_t core = 0; core < executor.get_core_count(); ++core) {
+        const CoreStats& stats = executor.get_core_stats(core);
+        std::cout << "  Core " << core << ": "
+                  << (100.0 * stats.busy_time / std::max<uint64_t>(1, simulation_time))
+                  << "% busy, " << stats.dispatches << " dispatches, "
+                  << stats.steals << " steals\n";
+    }
+    std::cout << "\n";
+}
+
 std::string OSSimulator::generate_final_report() const {
     std::ostringstream report;
     report << "\n=== Final Performance Analysis ===\n\n";
@@ -275,7 +1019,18 @@ void OSSimulator::reset() {
     analytics_->reset();
 }
 
+void OSSimulator::reset_workload(size_t num_processes, uint64_t total_memory) {
+    // Terminate leftovers while their processes still exist
+    scheduler_->reset();
+    memory_manager_->reset();
+    hardware_simulator_->reset();
+    random_gen_->set_seed(42);
+    create_test_processes(num_processes, total_memory);
+}
+
 void OSSimulator::create_test_processes(size_t num_processes, uint64_t total_memory) {
+    // Wait queues link through the processes about to be destroyed
+    hardware_simulator_->clear_wait_queues();
     process_manager_->reset();
     
     for (size_t i = 0; i < num_processes; ++i) {
@@ -286,6 +1041,11 @@ void OSSimulator::create_test_processes(size_t num_processes, uint64_t total_mem
         
         Process* process = process_manager_->create_process(arrival_time, burst_time, memory_req, priority);
         
+        // Critical processes model control loops with a completion deadline
+        if (priority == ProcessPriority::CRITICAL) {
+            process->set_relative_deadline(burst_time * 4);
+        }
+        
         // Allocate memory for process
         uint64_t allocated_addr = memory_manager_->allocate(process->get_pid(), memory_req);
         if (allocated_addr == 0) {
@@ -296,45 +1056,108 @@ void OSSimulator::create_test_processes(size_t num_processes, uint64_t total_mem
 
 PerformanceMetrics OSSimulator::run_simulation_iteration(SchedulingAlgorithm algorithm,
                                                       AllocationStrategy strategy,
-                                                      uint64_t simulation_time) {
+                                                      uint64_t simulation_time,
+                                                      uint64_t start_time) {
     scheduler_->set_algorithm(algorithm);
     memory_manager_->set_allocation_strategy(strategy);
     
     simulation_timer_->start();
     analytics_->set_time_bounds(0, simulation_time);
     
-    uint64_t current_time = 0;
+    // The clock restarts, so I/O still pending from an earlier run is done
+    hardware_simulator_->complete_all_io(start_time);
+    
+    uint64_t current_time = start_time;
     const uint64_t time_step = 10; // 10ms time steps
+    const uint32_t io_devices = 4; // Disks and NICs blocked processes wait on
+    std::vector<Process*> last_on_core(scheduler_->get_core_count(), nullptr);
+    std::vector<Process*> still_running(scheduler_->get_core_count(), nullptr);
+    std::vector<uint64_t> slice_left(scheduler_->get_core_count(), 0);
     
     while (current_time < simulation_time) {
-        // Process ready processes
-        auto ready_processes = process_manager_->get_processes_by_state(ProcessState::READY);
-        for (auto* process : ready_processes) {
-            if (process->get_arrival_time() <= current_time) {
-                scheduler_->add_to_ready_queue(process);
+        scheduler_->tick(current_time);
+        
+        // Admit arrived processes; queued processes are already READY
+        auto new_processes = process_manager_->get_processes_by_state(ProcessState::NEW);
+        new_processes.erase(std::remove_if(new_processes.begin(), new_processes.end(),
+                                           [current_time](const Process* process) {
+                                               return process->get_arrival_time() > current_time;
+                                           }),
+                            new_processes.end());
+        scheduler_->add_to_ready_queue(new_processes.data(), new_processes.size());
+        
+        // Gangs claim their cores first; the remaining cores dispatch independently
+        std::vector<Process*> slots = scheduler_->schedule_gangs();
+        
+        // A step runs at most time_step of a slice, so a running process keeps
+        // its core until its slice is used up (under SJF until its burst ends),
+        // or until a shorter arrival takes it over through the timer interrupt
+        // path under a preemptive policy
+        for (size_t core = 0; core < slots.size(); ++core) {
+            Process* running = still_running[core];
+            still_running[core] = nullptr;
+            if (!running) {
+                continue;
+            }
+            if (!slots[core] && !scheduler_->should_preempt(running, core)) {
+                slots[core] = running;
+            } else {
+                hardware_simulator_->preempt_process(running, core, current_time);
+                slice_left[core] = 0;
             }
         }
+        scheduler_->get_next_processes(slots.size(), slots.data());
         
-        // Execute processes
-        Process* current_process = scheduler_->get_next_process();
-        if (current_process) {
-            // Simulate execution
-            bool completed = current_process->execute(scheduler_->get_ready_queue_size() > 0 ? 10 : 50);
-            
-            if (completed) {
-                current_process->set_state(ProcessState::TERMINATED);
-                current_process->set_completion_time(current_time);
+        // Execute one process per core
+        for (size_t core = 0; core < slots.size(); ++core) {
+            Process* current_process = slots[core];
+            if (current_process) {
+                // Charge a switch unless the core keeps running the same process
+                if (current_process != last_on_core[core]) {
+                    scheduler_->simulate_context_switch(nullptr, current_process, current_time, core);
+                    last_on_core[core] = current_process;
+                }
                 
-                // Deallocate memory
-                memory_manager_->deallocate_all(current_process->get_pid());
-            } else {
-                // Add back to ready queue or simulate I/O
-                if (random_gen_->generate_arrival_time(0, 100) < 10) {
-                    // Simulate I/O operation
-                    hardware_simulator_->simulate_io_interrupt(current_process->get_pid(), current_time);
-                    current_process->set_state(ProcessState::BLOCKED);
+                // Grant a slice on dispatch, and again when a process holding
+                // its core has used the last one up
+                if (slice_left[core] == 0) {
+                    slice_left[core] = scheduler_->get_ready_queue_size() > 0 ?
+                        scheduler_->get_time_slice(current_process) :
+                        scheduler_->get_uncontended_time_slice();
+                    // Gangs are co-scheduled one step at a time, so their
+                    // members leave their cores together
+                    if (scheduler_->is_gang_scheduling()) {
+                        slice_left[core] = std::min(slice_left[core], time_step);
+                    }
+                }
+                
+                // Simulate execution
+                uint64_t runtime = std::min({slice_left[core], time_step,
+                                             current_process->get_remaining_time()});
+                bool completed = current_process->execute(runtime);
+                scheduler_->account_runtime(current_process, runtime);
+                slice_left[core] -= runtime;
+                
+                if (completed) {
+                    current_process->set_state(ProcessState::TERMINATED);
+                    current_process->set_completion_time(current_time + runtime);
+                    slice_left[core] = 0;
+                
+                    // Deallocate memory
+                    memory_manager_->deallocate_all(current_process->get_pid());
                 } else {
-                    scheduler_->add_to_ready_queue(current_process);
+                    // Keep running, add back to ready queue or simulate I/O
+                    if (random_gen_->generate_arrival_time(0, 100) < 10) {
+                        // Block until the device's completion interrupt wakes it
+                        uint32_t device = current_process->get_pid() % io_devices;
+                        uint64_t latency = random_gen_->generate_burst_time(5, 100);
+                        hardware_simulator_->start_io(current_process, device, current_time, latency);
+                        slice_left[core] = 0;
+                    } else if (slice_left[core] > 0 || scheduler_->holds_core()) {
+                        still_running[core] = current_process;
+                    } else {
+                        scheduler_->add_to_ready_queue(current_process);
+                    }
                 }
             }
         }
@@ -353,6 +1176,13 @@ PerformanceMetrics OSSimulator::run_simulation_iteration(SchedulingAlgorithm alg
         }
     }
     
+    // Processes still holding a core wait in the ready queue for the next run
+    for (Process* running : still_running) {
+        if (running) {
+            scheduler_->add_to_ready_queue(running);
+        }
+    }
+    
     simulation_timer_->stop();
     return analytics_->calculate_metrics();
 }
@@ -382,6 +1212,33 @@ int main() {
         // Run memory benchmark
         simulator.run_memory_benchmark(50, 1024 * 1024 * 256);
         
+        // Allocate from free space split into many small fragments
+        simulator.run_fragmentation_benchmark(50000, 2000);
+        
+        // Run gang scheduling comparison
+        simulator.run_gang_benchmark(60, 1024 * 1024 * 256, 3);
+        
+        // Run tenants under CPU group weights and quotas
+        simulator.run_tenant_benchmark(60, 1024 * 1024 * 256);
+        
+        // Run statically dispatched policies on one core
+        simulator.run_policy_benchmark(50, 1024 * 1024 * 256, 5000);
+        
+        // Run periodic control loops admitted by response-time analysis
+        simulator.run_rate_monotonic_benchmark(4000);
+        
+        // Run CRITICAL work blocked behind a LOW lock holder
+        simulator.run_lock_benchmark(10000);
+        
+        // Per-class p99 wait SLOs under strict priority vs the SLO policy
+        simulator.run_slo_benchmark(50, 1024 * 1024 * 256);
+        
+        // Evaluate candidate policies from one mid-run snapshot
+        simulator.run_what_if_benchmark(50, 1024 * 1024 * 256);
+        
+        // Run simulated cores on host threads
+        simulator.run_parallel_simulation(1000, 1024 * 1024 * 512, 10000, 4, 100);
+        
         // Generate final report
         std::cout << simulator.generate_final_report();
         
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace osro {
+
+/**
+ * @brief Index of the least significant set bit
+ * @param mask Bit mask, must not be zero
+ * @return unsigned Bit index (0-63)
+ */
+inline unsigned find_first_set(uint64_t mask) noexcept {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+}
+
+/**
+ * @brief Index of the most significant set bit
+ * @param mask Bit mask, must not be zero
+ * @return unsigned Bit index (0-63)
+ */
+inline unsigned find_last_set(uint64_t mask) noexcept {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return 63u - static_cast<unsigned>(__builtin_clzll(mask));
+#endif
+}
+
+} // namespace osro
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+
+namespace osro {
+
+/**
+ * @brief Reusable thread barrier with a serial completion step
+ * 
+ * Once every participant has arrived, the last one runs the completion
+ * function while the others are still blocked, then all are released
+ * together. Everything written before arriving or inside the completion
+ * function is visible to every participant after the barrier.
+ */
+class EpochBarrier {
+public:
+    /**
+     * @brief Construct a new Epoch Barrier
+     * @param participants Number of threads that must arrive per epoch
+     * @param on_completion Serial step run by the last arriving thread (must not throw)
+     */
+    EpochBarrier(size_t participants, std::function<void()> on_completion)
+        : participants_(participants),
+          waiting_(0),
+          generation_(0),
+          on_completion_(std::move(on_completion)) {
+        if (participants == 0) {
+            throw std::invalid_argument("Barrier needs at least one participant");
+        }
+    }
+    EpochBarrier(const EpochBarrier&) = delete;
+    EpochBarrier& operator=(const EpochBarrier&) = delete;
+
+    /**
+     * @brief Block until all participants have arrived
+     */
+    void arrive_and_wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        uint64_t generation = generation_;
+        
+        if (++waiting_ == participants_) {
+            if (on_completion_) {
+                on_completion_();
+            }
+            waiting_ = 0;
+            ++generation_;
+            lock.unlock();
+            released_.notify_all();
+            return;
+        }
+        
+        released_.wait(lock, [this, generation] { return generation_ != generation; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable released_;
+    size_t participants_;
+    size_t waiting_;
+    uint64_t generation_;
+    std::function<void()> on_completion_;
+};
+
+} // namespace osro
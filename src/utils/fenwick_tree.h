@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Binary indexed tree over non-negative weights
+ * 
+ * Supports point updates, prefix sums and weighted selection ("which
+ * index does the r-th unit of weight fall into") in O(log n). Elements
+ * can be appended in O(log n) so the tree grows with its user.
+ * 
+ * @tparam T Unsigned arithmetic weight type
+ */
+template<typename T>
+class FenwickTree {
+public:
+    /**
+     * @brief Append an element
+     * @param value Weight of the new element
+     */
+    void push_back(T value) {
+        // Node i covers (i - lowbit(i), i]; fold in the already-present part
+        size_t index = tree_.size() + 1;
+        size_t covered_from = index - (index & (~index + 1));
+        tree_.push_back(value + prefix_sum(index - 1) - prefix_sum(covered_from));
+        total_ += value;
+    }
+
+    /**
+     * @brief Add to the weight of an element
+     * @param index Zero-based element index
+     * @param delta Weight change (wraps for unsigned subtraction)
+     */
+    void add(size_t index, T delta) noexcept {
+        total_ += delta;
+        for (size_t i = index + 1; i <= tree_.size(); i += i & (~i + 1)) {
+            tree_[i - 1] += delta;
+        }
+    }
+
+    /**
+     * @brief Sum of the first count elements
+     * @param count Number of leading elements
+     * @return T Prefix sum
+     */
+    T prefix_sum(size_t count) const noexcept {
+        T sum = T();
+        for (size_t i = count; i > 0; i -= i & (~i + 1)) {
+            sum += tree_[i - 1];
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Find the element containing a weight offset
+     * @param offset Weight offset, must be below total()
+     * @return size_t Smallest index whose inclusive prefix sum exceeds offset
+     */
+    size_t find(T offset) const noexcept {
+        size_t position = 0;
+        size_t step = 1;
+        while ((step << 1) <= tree_.size()) {
+            step <<= 1;
+        }
+        for (; step > 0; step >>= 1) {
+            size_t next = position + step;
+            if (next <= tree_.size() && tree_[next - 1] <= offset) {
+                position = next;
+                offset -= tree_[next - 1];
+            }
+        }
+        return position;
+    }
+
+    T total() const noexcept { return total_; }
+    size_t size() const noexcept { return tree_.size(); }
+
+    void clear() noexcept {
+        tree_.clear();
+        total_ = T();
+    }
+
+private:
+    std::vector<T> tree_;
+    T total_ = T();
+};
+
+} // namespace osro
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+namespace osro {
+
+/**
+ * @brief Streaming quantile estimator (P-square algorithm)
+ *
+ * Tracks a single quantile of an unbounded stream in constant memory by
+ * keeping five markers whose heights are adjusted with piecewise-parabolic
+ * interpolation (Jain & Chlamtac, 1985). Exact for the first five samples.
+ */
+class P2Quantile {
+public:
+    /**
+     * @brief Construct an estimator
+     * @param quantile Quantile to track, strictly between 0 and 1
+     */
+    explicit P2Quantile(double quantile = 0.5) {
+        reset(quantile);
+    }
+
+    /**
+     * @brief Forget all samples and track a (possibly new) quantile
+     * @param quantile Quantile to track, strictly between 0 and 1
+     */
+    void reset(double quantile) {
+        if (!(quantile > 0.0 && quantile < 1.0)) {
+            throw std::invalid_argument("Quantile must be between 0 and 1");
+        }
+        quantile_ = quantile;
+        increments_ = {0.0, quantile / 2.0, quantile, (1.0 + quantile) / 2.0, 1.0};
+        desired_ = {1.0, 1.0 + 2.0 * quantile, 1.0 + 4.0 * quantile, 3.0 + 2.0 * quantile, 5.0};
+        positions_ = {1.0, 2.0, 3.0, 4.0, 5.0};
+        count_ = 0;
+    }
+
+    /**
+     * @brief Add a sample
+     * @param value Observed value
+     */
+    void add(double value) noexcept {
+        if (count_ < kMarkers) {
+            heights_[count_++] = value;
+            if (count_ == kMarkers) {
+                std::sort(heights_.begin(), heights_.end());
+            }
+            return;
+        }
+        count_++;
+
+        // Find the cell the sample falls into, widening the extremes
+        size_t cell;
+        if (value < heights_[0]) {
+            heights_[0] = value;
+            cell = 0;
+        } else if (value >= heights_[kMarkers - 1]) {
+            heights_[kMarkers - 1] = value;
+            cell = kMarkers - 2;
+        } else {
+            cell = 0;
+            while (value >= heights_[cell + 1]) {
+                ++cell;
+            }
+        }
+
+        for (size_t i = cell + 1; i < kMarkers; ++i) {
+            positions_[i] += 1.0;
+        }
+        for (size_t i = 0; i < kMarkers; ++i) {
+            desired_[i] += increments_[i];
+        }
+
+        // Nudge the three inner markers toward their desired positions
+        for (size_t i = 1; i + 1 < kMarkers; ++i) {
+            double offset = desired_[i] - positions_[i];
+            if ((offset >= 1.0 && positions_[i + 1] - positions_[i] > 1.0) ||
+                (offset <= -1.0 && positions_[i - 1] - positions_[i] < -1.0)) {
+                double step = offset >= 0.0 ? 1.0 : -1.0;
+                double height = parabolic(i, step);
+                if (!(heights_[i - 1] < height && height < heights_[i + 1])) {
+                    height = linear(i, step);
+                }
+                heights_[i] = height;
+                positions_[i] += step;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the current estimate
+     * @return double Estimated quantile, 0 if no samples were added
+     */
+    double get() const noexcept {
+        if (count_ == 0) {
+            return 0.0;
+        }
+        if (count_ <= kMarkers) {
+            // Exact quantile of the few samples seen so far
+            std::array<double, kMarkers> sorted = heights_;
+            std::sort(sorted.begin(), sorted.begin() + count_);
+            size_t rank = static_cast<size_t>(std::ceil(quantile_ * count_));
+            return sorted[rank > 0 ? rank - 1 : 0];
+        }
+        return heights_[2];
+    }
+
+    double get_quantile() const noexcept { return quantile_; }
+    size_t get_count() const noexcept { return count_; }
+
+private:
+    static constexpr size_t kMarkers = 5;
+
+    double quantile_;
+    size_t count_;
+    std::array<double, kMarkers> heights_{};
+    std::array<double, kMarkers> positions_{};
+    std::array<double, kMarkers> desired_{};
+    std::array<double, kMarkers> increments_{};
+
+    double parabolic(size_t i, double step) const noexcept {
+        const double n_prev = positions_[i - 1];
+        const double n = positions_[i];
+        const double n_next = positions_[i + 1];
+        return heights_[i] + step / (n_next - n_prev) *
+               ((n - n_prev + step) * (heights_[i + 1] - heights_[i]) / (n_next - n) +
+                (n_next - n - step) * (heights_[i] - heights_[i - 1]) / (n - n_prev));
+    }
+
+    double linear(size_t i, double step) const noexcept {
+        size_t j = step > 0.0 ? i + 1 : i - 1;
+        return heights_[i] + step * (heights_[j] - heights_[i]) / (positions_[j] - positions_[i]);
+    }
+};
+
+} // namespace osro
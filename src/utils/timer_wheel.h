@@ -0,0 +1,212 @@
+#pragma once
+
+#include "bit_ops.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Hierarchical timing wheel over integer ticks
+ *
+ * Level L holds 64 slots of 64^L ticks each. A timer goes to the lowest
+ * level whose slot still separates it from the current time, so
+ * scheduling is O(1); as time reaches a higher-level slot its timers
+ * cascade one level down, which happens at most kLevels times per
+ * timer. Timers further out than 64^kLevels ticks wait in an overflow
+ * list that is revisited once per full turn of the top level.
+ *
+ * A 64-bit occupancy mask per level lets advance() jump straight to the
+ * next slot that holds timers, so idle stretches cost nothing.
+ * Timers cannot be cancelled; owners that may stop waiting early tag
+ * entries and ignore stale ones when they fire.
+ *
+ * @tparam T Payload delivered when a timer expires
+ */
+template<typename T>
+class TimerWheel {
+public:
+    static constexpr unsigned kSlotBits = 6;
+    static constexpr size_t kSlots = size_t{1} << kSlotBits;
+    static constexpr size_t kLevels = 4;
+
+    /**
+     * @brief Construct an empty wheel
+     * @param start_time Current tick
+     */
+    explicit TimerWheel(uint64_t start_time = 0)
+        : now_(start_time) {}
+
+    /**
+     * @brief Arm a timer
+     * @param expires Tick at which the timer fires; ticks not after the
+     *        current time fire on the next advance()
+     * @param value Payload handed to the expiry callback
+     */
+    void schedule(uint64_t expires, T value) {
+        size_++;
+        if (expires <= now_) {
+            due_.push_back(Entry{expires, std::move(value)});
+        } else {
+            place(Entry{expires, std::move(value)});
+        }
+    }
+
+    /**
+     * @brief Advance time, firing every timer that expires on the way
+     *
+     * Timers fire in tick order; within the callback get_time() is the
+     * tick being processed. Timers armed from the callback for that
+     * tick or earlier fire on the next call.
+     *
+     * @param time New current tick (earlier ticks are ignored)
+     * @param expire Callable taking T&
+     */
+    template<typename Expire>
+    void advance(uint64_t time, Expire&& expire) {
+        if (!due_.empty()) {
+            std::vector<Entry> due;
+            due.swap(due_);
+            fire(due, expire);
+        }
+
+        while (now_ < time) {
+            now_ = next_event(time);
+            cascade();
+
+            size_t slot = static_cast<size_t>(now_ & (kSlots - 1));
+            if (occupied_[0] & (uint64_t{1} << slot)) {
+                occupied_[0] &= ~(uint64_t{1} << slot);
+                std::vector<Entry> expiring;
+                expiring.swap(slots_[0][slot]);
+                fire(expiring, expire);
+            }
+        }
+    }
+
+    /**
+     * @brief Get the current tick
+     * @return uint64_t Last tick advanced to
+     */
+    uint64_t get_time() const noexcept { return now_; }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Drop every timer and restart the clock
+     * @param start_time New current tick
+     */
+    void reset(uint64_t start_time = 0) {
+        for (auto& level : slots_) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+        occupied_.fill(0);
+        overflow_.clear();
+        due_.clear();
+        size_ = 0;
+        now_ = start_time;
+    }
+
+private:
+    struct Entry {
+        uint64_t expires;
+        T value;
+    };
+
+    // Ticks covered by one full turn of the top level
+    static constexpr unsigned kRangeBits = kSlotBits * kLevels;
+
+    std::array<std::array<std::vector<Entry>, kSlots>, kLevels> slots_;
+    std::array<uint64_t, kLevels> occupied_ = {};
+    std::vector<Entry> overflow_;
+    std::vector<Entry> due_;
+    uint64_t now_;
+    size_t size_ = 0;
+
+    /**
+     * @brief File a timer that expires at or after the current tick
+     * @param entry Timer to file
+     */
+    void place(Entry entry) {
+        uint64_t diff = entry.expires ^ now_;
+        size_t level = diff == 0 ? 0 : find_last_set(diff) / kSlotBits;
+        if (level >= kLevels) {
+            overflow_.push_back(std::move(entry));
+            return;
+        }
+
+        size_t slot = static_cast<size_t>((entry.expires >> (level * kSlotBits)) & (kSlots - 1));
+        slots_[level][slot].push_back(std::move(entry));
+        occupied_[level] |= uint64_t{1} << slot;
+    }
+
+    /**
+     * @brief Find the first tick after now that needs any work
+     * @param limit Tick to stop at if nothing happens earlier
+     * @return uint64_t Start of the nearest occupied slot, capped at limit
+     */
+    uint64_t next_event(uint64_t limit) const noexcept {
+        uint64_t next = limit;
+        for (size_t level = 0; level < kLevels; ++level) {
+            unsigned shift = static_cast<unsigned>(level) * kSlotBits;
+            size_t digit = static_cast<size_t>((now_ >> shift) & (kSlots - 1));
+            uint64_t later = digit + 1 < kSlots ? occupied_[level] & (~uint64_t{0} << (digit + 1)) : 0;
+            if (later) {
+                uint64_t base = (now_ >> (shift + kSlotBits)) << (shift + kSlotBits);
+                next = std::min(next, base + (uint64_t{find_first_set(later)} << shift));
+            }
+        }
+        if (!overflow_.empty()) {
+            next = std::min(next, ((now_ >> kRangeBits) + 1) << kRangeBits);
+        }
+        return next;
+    }
+
+    /**
+     * @brief Move the timers of every slot starting at the current tick
+     *        one level closer, highest level first
+     */
+    void cascade() {
+        if ((now_ & ((uint64_t{1} << kRangeBits) - 1)) == 0 && !overflow_.empty()) {
+            std::vector<Entry> overflow;
+            overflow.swap(overflow_);
+            for (Entry& entry : overflow) {
+                place(std::move(entry));
+            }
+        }
+
+        for (size_t level = kLevels - 1; level > 0; --level) {
+            unsigned shift = static_cast<unsigned>(level) * kSlotBits;
+            if ((now_ & ((uint64_t{1} << shift) - 1)) != 0) {
+                continue;
+            }
+
+            size_t slot = static_cast<size_t>((now_ >> shift) & (kSlots - 1));
+            if (occupied_[level] & (uint64_t{1} << slot)) {
+                occupied_[level] &= ~(uint64_t{1} << slot);
+                std::vector<Entry> moving;
+                moving.swap(slots_[level][slot]);
+                for (Entry& entry : moving) {
+                    place(std::move(entry));
+                }
+            }
+        }
+    }
+
+    template<typename Expire>
+    void fire(std::vector<Entry>& entries, Expire& expire) {
+        size_ -= entries.size();
+        for (Entry& entry : entries) {
+            expire(entry.value);
+        }
+    }
+};
+
+} // namespace osro
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace osro {
+
+/**
+ * @brief Lock-free Chase-Lev work-stealing deque
+ * 
+ * The owning thread pushes and pops at the bottom without contention;
+ * any other thread may steal from the top. Only the last element is ever
+ * contended, and that race is settled by a single compare-and-swap. The
+ * ring buffer grows on demand; retired buffers are kept until the deque
+ * is destroyed because a concurrent thief may still be reading them.
+ * 
+ * @tparam T Trivially copyable element type (typically a pointer)
+ */
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Work-stealing deque elements must be trivially copyable");
+
+public:
+    /**
+     * @brief Construct a new Work Stealing Deque
+     * @param capacity Initial capacity (rounded up to a power of two)
+     */
+    explicit WorkStealingDeque(size_t capacity = 64) : top_(0), bottom_(0) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Deque capacity must be greater than 0");
+        }
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        buffers_.push_back(std::make_unique<Buffer>(rounded));
+        buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+    }
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Push an element at the bottom (owner thread only)
+     * @param item Element to push
+     */
+    void push(T item) {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        
+        if (bottom - top >= static_cast<int64_t>(buffer->capacity)) {
+            buffer = grow(buffer, top, bottom);
+        }
+        
+        buffer->store(bottom, item);
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pop the most recently pushed element (owner thread only)
+     * @param item Receives the element on success
+     * @return bool False if the deque was empty or the last element was stolen
+     */
+    bool pop(T& item) {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        
+        item = buffer->load(bottom);
+        if (top == bottom) {
+            // Last element: race thieves for it
+            bool won = top_.compare_exchange_strong(top, top + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Steal the oldest element (any thread)
+     * @param item Receives the element on success
+     * @return bool False if the deque was empty or another thread won the race
+     */
+    bool steal(T& item) {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = bottom_.load(std::memory_order_acquire);
+        
+        if (top >= bottom) {
+            return false;
+        }
+        
+        Buffer* buffer = buffer_.load(std::memory_order_acquire);
+        T stolen = buffer->load(top);
+        if (!top_.compare_exchange_strong(top, top + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return false;
+        }
+        item = stolen;
+        return true;
+    }
+
+    /**
+     * @brief Get the number of elements (exact only while quiescent)
+     * @return size_t Element count
+     */
+    size_t size() const noexcept {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+
+private:
+    struct Buffer {
+        size_t capacity;
+        size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+        
+        explicit Buffer(size_t size)
+            : capacity(size), mask(size - 1), slots(new std::atomic<T>[size]) {}
+        
+        T load(int64_t index) const noexcept {
+            return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+        
+        void store(int64_t index, T item) noexcept {
+            slots[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<int64_t> top_;
+    alignas(64) std::atomic<int64_t> bottom_;
+    std::atomic<Buffer*> buffer_;
+    std::vector<std::unique_ptr<Buffer>> buffers_; // Owner only; includes retired buffers
+
+    Buffer* grow(Buffer* old, int64_t top, int64_t bottom) {
+        auto larger = std::make_unique<Buffer>(old->capacity * 2);
+        for (int64_t i = top; i < bottom; ++i) {
+            larger->store(i, old->load(i));
+        }
+        Buffer* raw = larger.get();
+        buffers_.push_back(std::move(larger));
+        buffer_.store(raw, std::memory_order_release);
+        return raw;
+    }
+};
+
+} // namespace osro
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include "../src/core/indexed_heap.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace osro;
+
+namespace {
+
+// Orders by aging key, which tests can set freely, then by PID
+struct KeyLess {
+    bool operator()(const Process* a, const Process* b) const {
+        if (a->get_aging_key() != b->get_aging_key()) {
+            return a->get_aging_key() < b->get_aging_key();
+        }
+        return a->get_pid() < b->get_pid();
+    }
+};
+
+using Reference = std::set<Process*, KeyLess>;
+
+std::vector<std::unique_ptr<Process>> make_processes(size_t count) {
+    std::vector<std::unique_ptr<Process>> processes;
+    for (size_t i = 0; i < count; ++i) {
+        processes.push_back(std::make_unique<Process>(static_cast<uint32_t>(i + 1), 0, 10, 4096,
+                                                      ProcessPriority::MEDIUM));
+    }
+    return processes;
+}
+
+template<typename Heap>
+void expect_valid(const Heap& heap, size_t arity) {
+    const std::vector<Process*>& data = heap.data();
+    KeyLess less;
+    for (size_t i = 0; i < data.size(); ++i) {
+        ASSERT_EQ(data[i]->get_queue_hook().slot, i);
+        ASSERT_TRUE(heap.contains(data[i]));
+        if (i > 0) {
+            ASSERT_FALSE(less(data[i], data[(i - 1) / arity])) << "slot " << i;
+        }
+    }
+}
+
+template<size_t Arity>
+void run_churn(uint64_t seed) {
+    SCOPED_TRACE(Arity);
+    std::mt19937_64 random(seed);
+    auto processes = make_processes(512);
+    IndexedHeap<KeyLess, Arity> heap;
+    Reference reference;
+
+    for (int step = 0; step < 20000; ++step) {
+        Process* process = processes[random() % processes.size()].get();
+        uint64_t roll = random() % 100;
+        if (roll < 35) {
+            if (!heap.contains(process)) {
+                process->set_aging_key(random() % 1000);
+                heap.push(process);
+                reference.insert(process);
+            }
+        } else if (roll < 55) {
+            Process* expected = reference.empty() ? nullptr : *reference.begin();
+            ASSERT_EQ(heap.pop(), expected);
+            reference.erase(expected);
+        } else if (roll < 75) {
+            ASSERT_EQ(heap.erase(process), reference.erase(process) == 1);
+        } else if (roll < 95) {
+            // Re-key in place, both up and down
+            bool queued = reference.erase(process) == 1;
+            process->set_aging_key(random() % 1000);
+            ASSERT_EQ(heap.update(process), queued);
+            if (queued) {
+                reference.insert(process);
+            }
+        } else {
+            // Batches small enough to sift and large enough to rebuild
+            std::vector<Process*> batch;
+            size_t count = 1 + random() % (roll < 98 ? 4 : 200);
+            for (size_t i = 0; i < count; ++i) {
+                Process* candidate = processes[random() % processes.size()].get();
+                if (!heap.contains(candidate) &&
+                    std::find(batch.begin(), batch.end(), candidate) == batch.end()) {
+                    candidate->set_aging_key(random() % 1000);
+                    batch.push_back(candidate);
+                }
+            }
+            heap.push_range(batch.data(), batch.size());
+            reference.insert(batch.begin(), batch.end());
+        }
+
+        ASSERT_EQ(heap.size(), reference.size());
+        ASSERT_EQ(heap.top(), reference.empty() ? nullptr : *reference.begin());
+        expect_valid(heap, Arity);
+        if (::testing::Test::HasFatalFailure()) {
+            FAIL() << "step " << step;
+        }
+    }
+
+    // Draining yields the reference order
+    for (Process* expected : reference) {
+        ASSERT_EQ(heap.pop(), expected);
+    }
+    EXPECT_TRUE(heap.empty());
+}
+
+} // namespace
+
+TEST(IndexedHeapTest, MatchesOrderedSetUnderChurn) {
+    run_churn<2>(1);
+    run_churn<4>(2);
+    run_churn<8>(3);
+}
+
+TEST(IndexedHeapTest, AssignHeapifiesAndReleaseDetaches) {
+    std::mt19937_64 random(4);
+    auto processes = make_processes(100);
+    std::vector<Process*> members;
+    for (auto& process : processes) {
+        process->set_aging_key(random() % 20);
+        members.push_back(process.get());
+    }
+
+    IndexedHeap<KeyLess> heap;
+    heap.assign(members);
+    expect_valid(heap, 4);
+    EXPECT_EQ(heap.top(), *std::min_element(members.begin(), members.end(), KeyLess()));
+
+    std::vector<Process*> released = heap.release();
+    EXPECT_EQ(released.size(), members.size());
+    EXPECT_TRUE(heap.empty());
+    for (Process* process : released) {
+        EXPECT_FALSE(heap.contains(process));
+        EXPECT_EQ(process->get_queue_hook().slot, QueueHook::npos);
+    }
+}
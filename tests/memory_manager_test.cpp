@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "../src/core/memory_manager.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace osro;
+
+namespace {
+
+// The linear scans MemoryManager used before free blocks were indexed
+uint64_t reference_fit(const std::vector<MemoryBlock>& blocks, uint64_t size,
+                       AllocationStrategy strategy, bool& found) {
+    size_t chosen = SIZE_MAX;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        const MemoryBlock& block = blocks[i];
+        if (block.is_allocated || block.size < size) {
+            continue;
+        }
+        if (chosen == SIZE_MAX) {
+            chosen = i;
+            if (strategy == AllocationStrategy::FIRST_FIT) {
+                break;
+            }
+        } else if (strategy == AllocationStrategy::BEST_FIT && block.size < blocks[chosen].size) {
+            chosen = i;
+        } else if (strategy == AllocationStrategy::WORST_FIT && block.size > blocks[chosen].size) {
+            chosen = i;
+        }
+    }
+    found = chosen != SIZE_MAX;
+    return found ? blocks[chosen].address : 0;
+}
+
+void expect_consistent(const MemoryManager& memory) {
+    std::vector<MemoryBlock> blocks = memory.get_memory_map();
+    uint64_t free_bytes = 0;
+    uint64_t largest_free = 0;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (!blocks[i].is_allocated) {
+            free_bytes += blocks[i].size;
+            largest_free = std::max(largest_free, blocks[i].size);
+        }
+        if (i == 0) {
+            continue;
+        }
+        ASSERT_LE(blocks[i - 1].address + blocks[i - 1].size, blocks[i].address);
+        ASSERT_FALSE(!blocks[i - 1].is_allocated && !blocks[i].is_allocated)
+            << "Adjacent free blocks at " << blocks[i - 1].address << " and " << blocks[i].address;
+    }
+    ASSERT_EQ(memory.get_free_memory(), free_bytes);
+    if (free_bytes > 0) {
+        EXPECT_DOUBLE_EQ(memory.get_fragmentation(),
+                         1.0 - static_cast<double>(largest_free) / free_bytes);
+    }
+}
+
+} // namespace
+
+TEST(MemoryManagerTest, SplitsAndCoalescesWithBothNeighbors) {
+    MemoryManager memory(64 * 4096, 4096, AllocationStrategy::FIRST_FIT);
+    uint64_t a = memory.allocate(1, 4096);
+    uint64_t b = memory.allocate(2, 4096);
+    uint64_t c = memory.allocate(3, 4096);
+    EXPECT_EQ(memory.get_memory_map().size(), 4u);
+
+    EXPECT_TRUE(memory.deallocate(1, a));
+    EXPECT_TRUE(memory.deallocate(3, c));
+    EXPECT_EQ(memory.get_memory_map().size(), 3u);
+
+    // Freeing the middle block merges it with the free blocks on both sides
+    EXPECT_TRUE(memory.deallocate(2, b));
+    ASSERT_EQ(memory.get_memory_map().size(), 1u);
+    EXPECT_EQ(memory.get_free_memory(), 64u * 4096);
+    EXPECT_FALSE(memory.deallocate(2, b));
+}
+
+TEST(MemoryManagerTest, KeepsRemaindersSmallerThanAPage) {
+    MemoryManager memory(3 * 4096, 4096, AllocationStrategy::BEST_FIT);
+    memory.allocate(1, 2 * 4096 + 100);
+
+    // The 4 KB minus 100 bytes left over stays with the allocation
+    EXPECT_EQ(memory.get_memory_map().size(), 1u);
+    EXPECT_EQ(memory.get_free_memory(), 0u);
+    EXPECT_EQ(memory.allocate(2, 1), 0u);
+}
+
+TEST(MemoryManagerTest, StrategiesMatchLinearScanUnderChurn) {
+    for (AllocationStrategy strategy : {AllocationStrategy::FIRST_FIT,
+                                        AllocationStrategy::BEST_FIT,
+                                        AllocationStrategy::WORST_FIT}) {
+        SCOPED_TRACE(static_cast<int>(strategy));
+        std::mt19937_64 random(static_cast<uint64_t>(strategy) + 1);
+        MemoryManager memory(1 << 24, 64, strategy);
+        std::vector<std::pair<uint32_t, uint64_t>> live;  // Owner, address
+
+        for (int step = 0; step < 20000; ++step) {
+            uint64_t roll = random() % 100;
+            if (live.empty() || roll < 60) {
+                // Mostly small requests with the odd large one
+                uint64_t size = 1 + random() % (roll < 50 ? 512 : 65536);
+                uint32_t owner = static_cast<uint32_t>(1 + random() % 32);
+                bool found = false;
+                uint64_t expected = reference_fit(memory.get_memory_map(), size, strategy, found);
+                ASSERT_EQ(memory.allocate(owner, size), expected) << "step " << step;
+                if (found) {
+                    live.emplace_back(owner, expected);
+                }
+            } else if (roll < 98) {
+                size_t victim = static_cast<size_t>(random() % live.size());
+                ASSERT_TRUE(memory.deallocate(live[victim].first, live[victim].second));
+                live[victim] = live.back();
+                live.pop_back();
+            } else if (roll < 99) {
+                uint32_t owner = static_cast<uint32_t>(1 + random() % 32);
+                memory.deallocate_all(owner);
+                std::vector<std::pair<uint32_t, uint64_t>> kept;
+                for (const auto& entry : live) {
+                    if (entry.first != owner) {
+                        kept.push_back(entry);
+                    }
+                }
+                live.swap(kept);
+            } else {
+                // Allocated blocks keep their addresses
+                memory.garbage_collect();
+            }
+            expect_consistent(memory);
+            if (HasFatalFailure()) {
+                FAIL() << "step " << step;
+            }
+        }
+    }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "../src/core/policy_scheduler.h"
+#include "../src/core/process_manager.h"
+#include "../src/core/scheduler.h"
+#include "../src/core/scheduler_snapshot.h"
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace osro;
+
+namespace {
+
+const ProcessPriority kPriorities[] = {
+    ProcessPriority::LOW, ProcessPriority::MEDIUM, ProcessPriority::HIGH, ProcessPriority::CRITICAL
+};
+
+// Runs a single-core LOTTERY workload whose ready queue shrinks, leaving
+// free ticket slots, then grows again through late arrivals. Returns the
+// PIDs in dispatch order; with checkpoint set, the scheduler is restored
+// from its own serialized checkpoint halfway through.
+std::vector<uint32_t> run_lottery(bool checkpoint) {
+    ProcessManager processes;
+    Scheduler scheduler(SchedulingAlgorithm::LOTTERY);
+    std::vector<Process*> all;
+    for (size_t i = 0; i < 30; ++i) {
+        all.push_back(processes.create_process(0, 50 + i * 7, 4096, kPriorities[i % 4]));
+    }
+    for (size_t i = 0; i < 20; ++i) {
+        scheduler.add_to_ready_queue(all[i]);
+    }
+
+    std::mt19937 random(3);
+    std::vector<uint32_t> dispatched;
+    for (uint64_t step = 0; step < 400; ++step) {
+        scheduler.tick(step * 10);
+        if (checkpoint && step == 200) {
+            std::stringstream image(std::ios::in | std::ios::out | std::ios::binary);
+            scheduler.snapshot(processes).serialize(image);
+            scheduler.restore(SchedulerSnapshot::deserialize(image), processes);
+        }
+        if (step > 200 && step <= 210) {
+            scheduler.add_to_ready_queue(all[20 + step - 201]);
+        }
+
+        Process* process = scheduler.get_next_process(0);
+        if (!process) {
+            break;
+        }
+        dispatched.push_back(process->get_pid());
+        bool completed = process->execute(10);
+        scheduler.account_runtime(process, 10);
+        if (completed) {
+            process->set_state(ProcessState::TERMINATED);
+        } else if (random() % 5 == 0) {
+            scheduler.block_process(process);
+        } else {
+            scheduler.add_to_ready_queue(process);
+        }
+        for (Process* blocked : all) {
+            if (blocked->get_state() == ProcessState::BLOCKED && random() % 3 == 0) {
+                scheduler.add_to_ready_queue(blocked);
+            }
+        }
+    }
+    return dispatched;
+}
+
+} // namespace
+
+TEST(SchedulerTest, LotteryResumesWithTheLiveRunsDraws) {
+    std::vector<uint32_t> live = run_lottery(false);
+    std::vector<uint32_t> resumed = run_lottery(true);
+    ASSERT_EQ(live.size(), 400u);
+    EXPECT_EQ(live, resumed);
+}
+
+TEST(SchedulerTest, StaticPriorityPolicyAgesLikeTheScheduler) {
+    ProcessManager processes;
+    Scheduler scheduler(SchedulingAlgorithm::PRIORITY);
+    PolicyScheduler<PriorityPolicy> policy;
+    scheduler.set_priority_aging(20);
+    policy.get_policy().set_aging_interval(20);
+
+    // Later arrivals of every priority, so aged LOW processes overtake fresh HIGH ones
+    std::vector<Process*> all;
+    for (size_t i = 0; i < 24; ++i) {
+        all.push_back(processes.create_process(i * 20, 30, 4096, kPriorities[(i * 3) % 4]));
+    }
+
+    std::vector<uint32_t> expected;
+    std::vector<uint32_t> actual;
+    for (uint64_t now = 0; now < 1000; now += 10) {
+        scheduler.tick(now);
+        policy.tick(now);
+        for (Process* process : all) {
+            if (process->get_arrival_time() == now) {
+                scheduler.add_to_ready_queue(process);
+            }
+        }
+        if (now % 30 == 0) {
+            if (Process* process = scheduler.get_next_process(0)) {
+                expected.push_back(process->get_pid());
+            }
+        }
+    }
+    for (Process* process : all) {
+        process->set_state(ProcessState::NEW);
+    }
+    for (uint64_t now = 0; now < 1000; now += 10) {
+        policy.tick(now);
+        for (Process* process : all) {
+            if (process->get_arrival_time() == now) {
+                policy.add_to_ready_queue(process);
+            }
+        }
+        if (now % 30 == 0) {
+            if (Process* process = policy.get_next_process()) {
+                actual.push_back(process->get_pid());
+            }
+        }
+    }
+
+    ASSERT_EQ(expected.size(), all.size());
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(SchedulerTest, AgingCountsPriorityLevels) {
+    // LOW is three levels below CRITICAL, so it wins after three intervals
+    for (uint64_t critical_ready : {299, 301}) {
+        ProcessManager processes;
+        Scheduler scheduler(SchedulingAlgorithm::PRIORITY);
+        scheduler.set_priority_aging(100);
+        Process* low = processes.create_process(0, 50, 4096, ProcessPriority::LOW);
+        Process* critical = processes.create_process(0, 50, 4096, ProcessPriority::CRITICAL);
+
+        scheduler.tick(0);
+        scheduler.add_to_ready_queue(low);
+        scheduler.tick(critical_ready);
+        scheduler.add_to_ready_queue(critical);
+        EXPECT_EQ(scheduler.get_next_process(0), critical_ready < 300 ? critical : low) << critical_ready;
+    }
+}
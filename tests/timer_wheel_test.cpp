@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "../src/utils/timer_wheel.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace osro;
+
+namespace {
+
+constexpr uint64_t kNotFired = UINT64_MAX;
+
+// Offsets from the current tick that land in every level and in overflow
+uint64_t random_delay(std::mt19937_64& random) {
+    static const uint64_t kRanges[] = {
+        64, 64 * 64, 64 * 64 * 64, 64 * 64 * 64 * 64, uint64_t{1} << 28
+    };
+    return random() % kRanges[random() % 5];
+}
+
+} // namespace
+
+TEST(TimerWheelTest, FiresEveryTimerExactlyOnceAtItsTick) {
+    std::mt19937_64 random(7);
+    TimerWheel<size_t> wheel(1000);
+    std::vector<uint64_t> expires;
+    std::vector<uint64_t> fired_at;
+    uint64_t last_fired = 0;
+
+    auto expire = [&](size_t& id) {
+        ASSERT_EQ(fired_at[id], kNotFired) << "timer " << id << " fired twice";
+        fired_at[id] = wheel.get_time();
+        ASSERT_GE(wheel.get_time(), last_fired) << "timers fired out of order";
+        last_fired = wheel.get_time();
+    };
+
+    for (int round = 0; round < 2000; ++round) {
+        size_t arms = random() % 20;
+        for (size_t i = 0; i < arms; ++i) {
+            uint64_t now = wheel.get_time();
+            // A few are already due and fire at the start of the next advance
+            uint64_t when = random() % 10 == 0 ? now - random() % 100 : now + random_delay(random);
+            expires.push_back(when);
+            fired_at.push_back(kNotFired);
+            wheel.schedule(when, expires.size() - 1);
+        }
+
+        uint64_t start = wheel.get_time();
+        uint64_t target = start + (random() % 4 == 0 ? random_delay(random) : random() % 200);
+        last_fired = start;
+        wheel.advance(target, expire);
+        ASSERT_EQ(wheel.get_time(), target);
+
+        size_t pending = 0;
+        for (size_t id = 0; id < expires.size(); ++id) {
+            if (fired_at[id] == kNotFired) {
+                ASSERT_GT(expires[id], target) << "timer " << id << " missed its tick";
+                pending++;
+            } else if (expires[id] > start) {
+                ASSERT_EQ(fired_at[id], expires[id]) << "timer " << id;
+            } else {
+                ASSERT_LE(fired_at[id], start) << "overdue timer " << id;
+            }
+        }
+        ASSERT_EQ(wheel.size(), pending);
+    }
+
+    // Run out the clock past every overflow timer
+    wheel.advance(wheel.get_time() + (uint64_t{1} << 29), expire);
+    EXPECT_TRUE(wheel.empty());
+    for (size_t id = 0; id < expires.size(); ++id) {
+        EXPECT_NE(fired_at[id], kNotFired) << "timer " << id;
+    }
+}
+
+TEST(TimerWheelTest, TimersArmedFromCallbackFireLater) {
+    TimerWheel<int> wheel;
+    std::vector<uint64_t> ticks;
+    int remaining = 3;
+
+    wheel.schedule(100, 0);
+    auto rearm = [&](int&) {
+        ticks.push_back(wheel.get_time());
+        if (--remaining > 0) {
+            // Due now: deferred to the next advance; 5000 ticks out: cascades
+            wheel.schedule(wheel.get_time(), 0);
+            wheel.schedule(wheel.get_time() + 5000, 0);
+        }
+    };
+
+    wheel.advance(100, rearm);
+    EXPECT_EQ(ticks, (std::vector<uint64_t>{100}));
+
+    // The deferred timer fires first, still at tick 100; the one it arms
+    // for that tick waits for the call after this one
+    wheel.advance(20000, rearm);
+    EXPECT_EQ(ticks, (std::vector<uint64_t>{100, 100, 5100, 5100}));
+    EXPECT_EQ(wheel.size(), 1u);
+
+    wheel.advance(20000, rearm);
+    EXPECT_EQ(ticks, (std::vector<uint64_t>{100, 100, 5100, 5100, 20000}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, ResetDropsTimers) {
+    TimerWheel<int> wheel;
+    wheel.schedule(10, 1);
+    wheel.schedule(uint64_t{1} << 30, 2);
+    wheel.reset(50);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.get_time(), 50u);
+
+    int fired = 0;
+    wheel.advance(uint64_t{1} << 31, [&fired](int&) { fired++; });
+    EXPECT_EQ(fired, 0);
+}